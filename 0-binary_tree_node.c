@@ -12,7 +12,11 @@ binary_tree_t *binary_tree_node(binary_tree_t *parent, int value)
 	new_node = malloc(sizeof(binary_tree_t));
 	if (new_node == NULL)
 		return (NULL);
+	TREE_STAT_ADD(allocations, 1);
+	TREE_STAT_DEPTH(parent);
 	new_node->n = value;
+	new_node->color = RB_BLACK;
+	new_node->priority = 0;
 	new_node->parent = parent;
 	new_node->left = NULL;
 	new_node->right = NULL;
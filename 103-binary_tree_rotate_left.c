@@ -10,6 +10,7 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
 
 	if (!tree || !tree->right)
 		return (NULL);
+	TREE_STAT_ADD(rotations, 1);
 	new_root = tree->right;
 	tree->right = new_root->left;
 	if (new_root->left)
@@ -10,12 +10,17 @@ binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree)
 
 	if (!tree || !tree->left)
 		return (NULL);
+	TREE_STAT_ADD(rotations, 1);
 	new_root = tree->left;
 	tree->left = new_root->right;
 	if (new_root->right)
 		new_root->right->parent = tree;
-	new_root->right = tree;
 	new_root->parent = tree->parent;
+	if (tree->parent && tree->parent->left == tree)
+		tree->parent->left = new_root;
+	else if (tree->parent)
+		tree->parent->right = new_root;
 	tree->parent = new_root;
+	new_root->right = tree;
 	return (new_root);
 }
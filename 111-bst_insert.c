@@ -19,6 +19,7 @@ bst_t *bst_insert(bst_t **tree, int value)
 	current = *tree;
 	while (1)
 	{
+		TREE_STAT_ADD(comparisons, 1);
 		if (value < current->n)
 		{
 			if (current->left)
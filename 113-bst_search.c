@@ -9,6 +9,7 @@ bst_t *bst_search(const bst_t *tree, int value)
 {
 	if (!tree)
 		return (NULL);
+	TREE_STAT_ADD(comparisons, 1);
 	if (tree->n == value)
 		return ((bst_t *)tree);
 	if (value < tree->n)
@@ -12,6 +12,7 @@ bst_t *bst_remove(bst_t *root, int value)
 
 	if (!root)
 		return (NULL);
+	TREE_STAT_ADD(comparisons, 1);
 	if (value < root->n)
 		root->left = bst_remove(root->left, value);
 	else if (value > root->n)
@@ -21,12 +22,17 @@ bst_t *bst_remove(bst_t *root, int value)
 		if (!root->left)
 		{
 			tmp = root->right;
+			if (tmp)
+				tmp->parent = root->parent;
+			TREE_STAT_ADD(frees, 1);
 			free(root);
 			return (tmp);
 		}
 		else if (!root->right)
 		{
 			tmp = root->left;
+			tmp->parent = root->parent;
+			TREE_STAT_ADD(frees, 1);
 			free(root);
 			return (tmp);
 		}
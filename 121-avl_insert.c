@@ -10,9 +10,9 @@ size_t height(const binary_tree_t *tree)
 	{
 		size_t l = 0, r = 0;
 
-		l = tree->left ? 1 + binary_tree_height(tree->left) : 1;
-		r = tree->right ? 1 + binary_tree_height(tree->right) : 1;
-		return ((l > r) ? l : r);
+		l = tree->left ? 1 + binary_tree_height(tree->left) : 0;
+		r = tree->right ? 1 + binary_tree_height(tree->right) : 0;
+		return (1 + ((l > r) ? l : r));
 	}
 	return (0);
 }
@@ -40,7 +40,7 @@ avl_t *avl_insert_recursive(avl_t **tree, avl_t *parent,
 
 	if (*tree == NULL)
 		return (*new = binary_tree_node(parent, value));
-
+	TREE_STAT_ADD(comparisons, 1);
 	if ((*tree)->n > value)
 	{
 		(*tree)->left = avl_insert_recursive(&(*tree)->left, *tree, new, value);
@@ -57,6 +57,8 @@ avl_t *avl_insert_recursive(avl_t **tree, avl_t *parent,
 		return (*tree);
 
 	bfactor = balance(*tree);
+	if (bfactor > 1 || bfactor < -1)
+		TREE_STAT_ADD(rebalances, 1);
 	if (bfactor > 1 && (*tree)->left->n > value)
 		*tree = binary_tree_rotate_right(*tree);
 	else if (bfactor < -1 && (*tree)->right->n < value)
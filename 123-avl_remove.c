@@ -1,5 +1,30 @@
 #include "binary_trees.h"
 /**
+* avl_remove_balance - rebalances an AVL subtree after a removal below it
+* @root: pointer to the root node of the subtree
+* Return: pointer to the new root node of the subtree
+*/
+avl_t *avl_remove_balance(avl_t *root)
+{
+	int bfactor = binary_tree_balance(root);
+
+	if (bfactor > 1)
+	{
+		TREE_STAT_ADD(rebalances, 1);
+		if (binary_tree_balance(root->left) < 0)
+			binary_tree_rotate_left(root->left);
+		return (binary_tree_rotate_right(root));
+	}
+	if (bfactor < -1)
+	{
+		TREE_STAT_ADD(rebalances, 1);
+		if (binary_tree_balance(root->right) > 0)
+			binary_tree_rotate_right(root->right);
+		return (binary_tree_rotate_left(root));
+	}
+	return (root);
+}
+/**
 * avl_remove - removes a node from an AVL tree
 * @root: pointer to the root node of the tree for removing a node
 * @value: value to remove in the tree
@@ -11,6 +36,7 @@ avl_t *avl_remove(avl_t *root, int value)
 
 	if (!root)
 		return (NULL);
+	TREE_STAT_ADD(comparisons, 1);
 	if (root->n > value)
 		root->left = avl_remove(root->left, value);
 	else if (root->n < value)
@@ -19,12 +45,15 @@ avl_t *avl_remove(avl_t *root, int value)
 	{
 		if (!root->left && !root->right)
 		{
+			TREE_STAT_ADD(frees, 1);
 			free(root);
 			return (NULL);
 		}
 		else if (!root->left || !root->right)
 		{
 			node = root->left ? root->left : root->right;
+			node->parent = root->parent;
+			TREE_STAT_ADD(frees, 1);
 			free(root);
 			return (node);
 		}
@@ -34,5 +63,5 @@ avl_t *avl_remove(avl_t *root, int value)
 		root->n = node->n;
 		root->right = avl_remove(root->right, node->n);
 	}
-	return (root);
+	return (avl_remove_balance(root));
 }
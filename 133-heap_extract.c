@@ -108,6 +108,7 @@ int heap_extract(heap_t **root)
 	if (!heap_r->left && !heap_r->right)
 	{
 		*root = NULL;
+		TREE_STAT_ADD(frees, 1);
 		free(heap_r);
 		return (value);
 	}
@@ -117,6 +118,7 @@ int heap_extract(heap_t **root)
 		node->parent->right = NULL;
 	else
 		node->parent->left = NULL;
+	TREE_STAT_ADD(frees, 1);
 	free(node);
 	heapify(heap_r);
 	*root = heap_r;
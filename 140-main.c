@@ -0,0 +1,33 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    rb_t *root;
+    rb_t *node;
+    int array[] = {
+        98, 402, 12, 46, 128, 256, 512, 50
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    root = NULL;
+    for (i = 0; i < n; i++)
+    {
+        node = rb_insert(&root, array[i]);
+        printf("%sInserted: %d (%s)\n", i ? "\n" : "", node->n,
+               node->color == RB_RED ? "red" : "black");
+        binary_tree_print(root);
+    }
+    printf("Is %d rb: %d\n", root->n, binary_tree_is_rb(root));
+    node = rb_insert(&root, 46);
+    printf("Duplicate 46: %p\n", (void *)node);
+    binary_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,79 @@
+#include "binary_trees.h"
+/**
+* rb_rotate - rotates a red-black tree node, updating the root if it moved
+* @tree: double pointer to the root node of the red-black tree
+* @node: node to rotate around
+* @left: 1 for a left-rotation, 0 for a right-rotation
+* Return: void
+*/
+void rb_rotate(rb_t **tree, rb_t *node, int left)
+{
+	rb_t *new_root;
+
+	if (left)
+		new_root = binary_tree_rotate_left(node);
+	else
+		new_root = binary_tree_rotate_right(node);
+	if (new_root && !new_root->parent)
+		*tree = new_root;
+}
+/**
+* rb_insert_fixup - restores the red-black properties after an insertion
+* @tree: double pointer to the root node of the red-black tree
+* @node: freshly inserted red node
+* Return: void
+*/
+void rb_insert_fixup(rb_t **tree, rb_t *node)
+{
+	rb_t *parent, *grand, *uncle;
+
+	while (node->parent && node->parent->color == RB_RED)
+	{
+		parent = node->parent;
+		grand = parent->parent;
+		uncle = (grand->left == parent) ? grand->right : grand->left;
+		if (uncle && uncle->color == RB_RED)
+		{
+			parent->color = RB_BLACK;
+			uncle->color = RB_BLACK;
+			grand->color = RB_RED;
+			node = grand;
+			continue;
+		}
+		if (grand->left == parent && parent->right == node)
+		{
+			rb_rotate(tree, parent, 1);
+			node = parent;
+			parent = node->parent;
+		}
+		else if (grand->right == parent && parent->left == node)
+		{
+			rb_rotate(tree, parent, 0);
+			node = parent;
+			parent = node->parent;
+		}
+		parent->color = RB_BLACK;
+		grand->color = RB_RED;
+		rb_rotate(tree, grand, grand->left != parent);
+	}
+	(*tree)->color = RB_BLACK;
+}
+/**
+* rb_insert - inserts a value in a Red-Black Tree
+* @tree: double pointer to the root node of the tree to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+rb_t *rb_insert(rb_t **tree, int value)
+{
+	rb_t *node;
+
+	if (!tree)
+		return (NULL);
+	node = bst_insert(tree, value);
+	if (!node)
+		return (NULL);
+	node->color = RB_RED;
+	rb_insert_fixup(tree, node);
+	return (node);
+}
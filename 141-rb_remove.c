@@ -0,0 +1,114 @@
+#include "binary_trees.h"
+/**
+* rb_is_black - tells whether a red-black node is black
+* @node: pointer to the node to check, NULL leaves count as black
+* Return: 1 if node is black, 0 if it is red
+*/
+int rb_is_black(const rb_t *node)
+{
+	return (!node || node->color == RB_BLACK);
+}
+/**
+* rb_remove_far - handles the sibling cases that end the removal fixup
+* @root: double pointer to the root node of the red-black tree
+* @parent: parent of the doubly-black position
+* @sib: black sibling of the doubly-black position with a red child
+* @left: 1 if the doubly-black position is the left child of parent
+* Return: void
+*/
+void rb_remove_far(rb_t **root, rb_t *parent, rb_t *sib, int left)
+{
+	if (left && rb_is_black(sib->right))
+	{
+		sib->left->color = RB_BLACK;
+		sib->color = RB_RED;
+		rb_rotate(root, sib, 0);
+		sib = parent->right;
+	}
+	else if (!left && rb_is_black(sib->left))
+	{
+		sib->right->color = RB_BLACK;
+		sib->color = RB_RED;
+		rb_rotate(root, sib, 1);
+		sib = parent->left;
+	}
+	sib->color = parent->color;
+	parent->color = RB_BLACK;
+	if (left)
+		sib->right->color = RB_BLACK;
+	else
+		sib->left->color = RB_BLACK;
+	rb_rotate(root, parent, left);
+}
+/**
+* rb_remove_fixup - restores the red-black properties after a removal
+* @root: double pointer to the root node of the red-black tree
+* @node: node that replaced the removed black node, may be NULL
+* @parent: parent of node
+* Return: void
+*/
+void rb_remove_fixup(rb_t **root, rb_t *node, rb_t *parent)
+{
+	rb_t *sib;
+	int left;
+
+	while (node != *root && rb_is_black(node))
+	{
+		left = (parent->left == node);
+		sib = left ? parent->right : parent->left;
+		if (sib->color == RB_RED)
+		{
+			sib->color = RB_BLACK;
+			parent->color = RB_RED;
+			rb_rotate(root, parent, left);
+			sib = left ? parent->right : parent->left;
+		}
+		if (rb_is_black(sib->left) && rb_is_black(sib->right))
+		{
+			sib->color = RB_RED;
+			node = parent;
+			parent = node->parent;
+			continue;
+		}
+		rb_remove_far(root, parent, sib, left);
+		node = *root;
+	}
+	if (node)
+		node->color = RB_BLACK;
+}
+/**
+* rb_remove - removes a node from a Red-Black Tree
+* @root: pointer to the root node of the tree for removing a node
+* @value: value to remove in the tree
+* Return: pointer to the new root of the tree after removing the value
+*/
+rb_t *rb_remove(rb_t *root, int value)
+{
+	rb_t *node, *child, *parent;
+
+	node = bst_search(root, value);
+	if (!node)
+		return (root);
+	if (node->left && node->right)
+	{
+		child = node->right;
+		while (child->left)
+			child = child->left;
+		node->n = child->n;
+		node = child;
+	}
+	child = node->left ? node->left : node->right;
+	parent = node->parent;
+	if (child)
+		child->parent = parent;
+	if (!parent)
+		root = child;
+	else if (parent->left == node)
+		parent->left = child;
+	else
+		parent->right = child;
+	if (node->color == RB_BLACK)
+		rb_remove_fixup(&root, child, parent);
+	free(node);
+	return (root);
+}
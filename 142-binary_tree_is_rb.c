@@ -0,0 +1,38 @@
+#include "binary_trees.h"
+#include <limits.h>
+/**
+* rb_black_height - checks a red-black subtree and measures its black height
+* @tree: pointer to the root node of the subtree to check
+* @lo: minimum value allowed in the subtree
+* @hi: maximum value allowed in the subtree
+* Return: black height of the subtree, or -1 if it is not a valid RB subtree
+*/
+int rb_black_height(const binary_tree_t *tree, long lo, long hi)
+{
+	int left, right;
+
+	if (!tree)
+		return (1);
+	if (tree->n < lo || tree->n > hi)
+		return (-1);
+	if (tree->color == RB_RED &&
+		((tree->left && tree->left->color == RB_RED) ||
+		(tree->right && tree->right->color == RB_RED)))
+		return (-1);
+	left = rb_black_height(tree->left, lo, (long)tree->n - 1);
+	right = rb_black_height(tree->right, (long)tree->n + 1, hi);
+	if (left < 0 || right < 0 || left != right)
+		return (-1);
+	return (left + (tree->color == RB_BLACK));
+}
+/**
+* binary_tree_is_rb - checks if a binary tree is a valid Red-Black Tree
+* @tree: pointer to the root node of the tree to check
+* Return: 1 if tree is a valid Red-Black Tree, and 0 otherwise
+*/
+int binary_tree_is_rb(const binary_tree_t *tree)
+{
+	if (!tree || tree->color != RB_BLACK)
+		return (0);
+	return (rb_black_height(tree, INT_MIN, INT_MAX) > 0);
+}
@@ -0,0 +1,35 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    rb_t *root;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    root->left->color = RB_RED;
+    root->right->color = RB_RED;
+    binary_tree_print(root);
+    printf("Is %d rb: %d\n", root->n, binary_tree_is_rb(root));
+
+    root->left->right = binary_tree_node(root->left, 54);
+    root->left->right->color = RB_RED;
+    binary_tree_print(root);
+    printf("Is %d rb: %d\n", root->n, binary_tree_is_rb(root));
+
+    root->left->color = RB_BLACK;
+    binary_tree_print(root);
+    printf("Is %d rb: %d\n", root->n, binary_tree_is_rb(root));
+
+    root->right->color = RB_BLACK;
+    printf("Is %d rb: %d\n", root->n, binary_tree_is_rb(root));
+    binary_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * elapsed_ns - converts a clock() interval to nanoseconds per operation
+ * @start: clock value at the start of the run
+ * @ops: number of operations performed
+ *
+ * Return: average nanoseconds per operation
+ */
+double elapsed_ns(clock_t start, size_t ops)
+{
+    return ((double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / ops);
+}
+
+/**
+ * main - Benchmarks insert, search and remove on Red-Black vs AVL trees
+ * @ac: argument count
+ * @av: argument vector, av[1] is the optional number of keys
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    rb_t *rb = NULL;
+    avl_t *avl = NULL;
+    size_t i, n = 10000;
+    int *keys;
+    clock_t start;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys || !n)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+        keys[i] = rand();
+
+    printf("tree,op,n,ns_per_op\n");
+    start = clock();
+    for (i = 0; i < n; i++)
+        rb_insert(&rb, keys[i]);
+    printf("rb,insert,%lu,%.1f\n", (unsigned long)n, elapsed_ns(start, n));
+    start = clock();
+    for (i = 0; i < n; i++)
+        avl_insert(&avl, keys[i]);
+    printf("avl,insert,%lu,%.1f\n", (unsigned long)n, elapsed_ns(start, n));
+
+    start = clock();
+    for (i = 0; i < n; i++)
+        bst_search(rb, keys[i]);
+    printf("rb,search,%lu,%.1f\n", (unsigned long)n, elapsed_ns(start, n));
+    start = clock();
+    for (i = 0; i < n; i++)
+        bst_search(avl, keys[i]);
+    printf("avl,search,%lu,%.1f\n", (unsigned long)n, elapsed_ns(start, n));
+
+    if (!binary_tree_is_rb(rb) || !binary_tree_is_bst(avl))
+        return (1);
+
+    start = clock();
+    for (i = 0; i < n; i++)
+        rb = rb_remove(rb, keys[i]);
+    printf("rb,remove,%lu,%.1f\n", (unsigned long)n, elapsed_ns(start, n));
+    start = clock();
+    for (i = 0; i < n; i++)
+        avl = avl_remove(avl, keys[i]);
+    printf("avl,remove,%lu,%.1f\n", (unsigned long)n, elapsed_ns(start, n));
+    free(keys);
+    return (0);
+}
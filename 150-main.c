@@ -0,0 +1,33 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    splay_t *root;
+    splay_t *node;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    root = NULL;
+    for (i = 0; i < n; i++)
+        bst_insert(&root, array[i]);
+    binary_tree_print(root);
+    node = splay_search(&root, 32);
+    printf("Found: %d\n", node->n);
+    binary_tree_print(root);
+    node = splay_search(&root, 90);
+    printf("Found: %p, new root: %d\n", (void *)node, root->n);
+    binary_tree_print(root);
+    binary_tree_delete(root);
+    return (0);
+}
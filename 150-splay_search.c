@@ -0,0 +1,66 @@
+#include "binary_trees.h"
+/**
+* splay_rotate_up - rotates a node above its parent
+* @node: node to move one level up
+* Return: void
+*/
+void splay_rotate_up(splay_t *node)
+{
+	if (node->parent->left == node)
+		binary_tree_rotate_right(node->parent);
+	else
+		binary_tree_rotate_left(node->parent);
+}
+/**
+* splay - moves a node to the root of its Splay Tree with rotations
+* @tree: double pointer to the root node of the splay tree
+* @node: node to bring to the root
+* Return: void
+*/
+void splay(splay_t **tree, splay_t *node)
+{
+	splay_t *parent, *grand;
+
+	if (!tree || !node)
+		return;
+	while (node->parent)
+	{
+		parent = node->parent;
+		grand = parent->parent;
+		if (!grand)
+			splay_rotate_up(node);
+		else if ((grand->left == parent) == (parent->left == node))
+		{
+			splay_rotate_up(parent);
+			splay_rotate_up(node);
+		}
+		else
+		{
+			splay_rotate_up(node);
+			splay_rotate_up(node);
+		}
+	}
+	*tree = node;
+}
+/**
+* splay_search - searches for a value in a Splay Tree and splays the last
+* node reached to the root
+* @tree: double pointer to the root node of the splay tree
+* @value: value to search in the tree
+* Return: pointer to the node containing value, or NULL if it is not found
+*/
+splay_t *splay_search(splay_t **tree, int value)
+{
+	splay_t *current, *last = NULL;
+
+	if (!tree)
+		return (NULL);
+	current = *tree;
+	while (current && current->n != value)
+	{
+		last = current;
+		current = (value < current->n) ? current->left : current->right;
+	}
+	splay(tree, current ? current : last);
+	return (current);
+}
@@ -0,0 +1,30 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    splay_t *root;
+    splay_t *node;
+    int array[] = {
+        98, 402, 12, 46, 128, 256, 512, 50
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    root = NULL;
+    for (i = 0; i < n; i++)
+    {
+        node = splay_insert(&root, array[i]);
+        printf("%sInserted: %d\n", i ? "\n" : "", node->n);
+        binary_tree_print(root);
+    }
+    printf("Is %d bst: %d\n", root->n, binary_tree_is_bst(root));
+    binary_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,19 @@
+#include "binary_trees.h"
+/**
+* splay_insert - inserts a value in a Splay Tree
+* @tree: double pointer to the root node of the tree to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+splay_t *splay_insert(splay_t **tree, int value)
+{
+	splay_t *node;
+
+	if (!tree)
+		return (NULL);
+	node = bst_insert(tree, value);
+	if (!node)
+		return (NULL);
+	splay(tree, node);
+	return (node);
+}
@@ -0,0 +1,31 @@
+#include "binary_trees.h"
+/**
+* splay_remove - removes a node from a Splay Tree
+* @root: pointer to the root node of the tree for removing a node
+* @value: value to remove in the tree
+* Return: pointer to the new root of the tree after removing the value
+*/
+splay_t *splay_remove(splay_t *root, int value)
+{
+	splay_t *node, *left, *right;
+
+	node = splay_search(&root, value);
+	if (!node)
+		return (root);
+	left = node->left;
+	right = node->right;
+	free(node);
+	if (right)
+		right->parent = NULL;
+	if (!left)
+		return (right);
+	left->parent = NULL;
+	node = left;
+	while (node->right)
+		node = node->right;
+	splay(&left, node);
+	left->right = right;
+	if (right)
+		right->parent = left;
+	return (left);
+}
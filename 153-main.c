@@ -0,0 +1,97 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * zipf_keys - draws keys in [0, n) following a Zipf distribution (s = 1)
+ * @out: array receiving the drawn keys
+ * @count: number of keys to draw
+ * @n: number of distinct keys, key k having rank k + 1
+ *
+ * Return: 0 on success, 1 on allocation failure
+ */
+int zipf_keys(int *out, size_t count, size_t n)
+{
+    double *cdf, sum = 0, u;
+    size_t i, lo, hi, mid;
+
+    cdf = malloc(sizeof(*cdf) * n);
+    if (!cdf)
+        return (1);
+    for (i = 0; i < n; i++)
+        cdf[i] = (sum += 1.0 / (i + 1));
+    for (i = 0; i < count; i++)
+    {
+        u = (double)rand() / RAND_MAX * sum;
+        for (lo = 0, hi = n - 1; lo < hi;)
+        {
+            mid = (lo + hi) / 2;
+            if (cdf[mid] < u)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        out[i] = (int)lo;
+    }
+    free(cdf);
+    return (0);
+}
+
+/**
+ * main - Benchmarks splay_search against bst_search on an AVL tree
+ * with Zipf-distributed lookups
+ * @ac: argument count
+ * @av: av[1] is the optional number of keys, av[2] the number of lookups
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    avl_t *avl;
+    splay_t *splay_root = NULL;
+    size_t i, j, n = 100000, lookups = 1000000;
+    int *keys, *stream, tmp;
+    clock_t start;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    if (ac > 2)
+        lookups = strtoul(av[2], NULL, 10);
+    keys = malloc(sizeof(*keys) * n);
+    stream = malloc(sizeof(*stream) * lookups);
+    if (!keys || !stream || !n || zipf_keys(stream, lookups, n))
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i;
+    avl = sorted_array_to_avl(keys, n);
+    srand(98);
+    for (i = n - 1; i > 0; i--)
+    {
+        j = rand() % (i + 1);
+        tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+    for (i = 0; i < n; i++)
+        splay_insert(&splay_root, keys[i]);
+
+    printf("tree,op,n,lookups,ns_per_op\n");
+    start = clock();
+    for (i = 0; i < lookups; i++)
+        bst_search(avl, keys[stream[i]]);
+    printf("avl,zipf_search,%lu,%lu,%.1f\n", (unsigned long)n,
+           (unsigned long)lookups,
+           (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / lookups);
+    start = clock();
+    for (i = 0; i < lookups; i++)
+        splay_search(&splay_root, keys[stream[i]]);
+    printf("splay,zipf_search,%lu,%lu,%.1f\n", (unsigned long)n,
+           (unsigned long)lookups,
+           (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / lookups);
+    binary_tree_delete(avl);
+    binary_tree_delete(splay_root);
+    free(keys);
+    free(stream);
+    return (0);
+}
@@ -0,0 +1,29 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    treap_t treap = {NULL, 98};
+    binary_tree_t *node;
+    int array[] = {
+        98, 402, 12, 46, 128, 256, 512, 50
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        node = treap_insert(&treap, array[i]);
+        printf("%sInserted: %d\n", i ? "\n" : "", node->n);
+        binary_tree_print(treap.root);
+    }
+    printf("Is %d bst: %d\n", treap.root->n, binary_tree_is_bst(treap.root));
+    binary_tree_delete(treap.root);
+    return (0);
+}
@@ -0,0 +1,43 @@
+#include "binary_trees.h"
+/**
+* treap_priority - draws the next node priority of a treap
+* @treap: pointer to the treap handle owning the generator
+* Return: a pseudo-random 31-bit priority
+*/
+unsigned int treap_priority(treap_t *treap)
+{
+	unsigned int x = treap->seed ? treap->seed : 2463534242u;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	treap->seed = x;
+	return ((x * 2654435761u) >> 1);
+}
+/**
+* treap_insert - inserts a value in a Treap
+* @treap: pointer to the treap handle to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+binary_tree_t *treap_insert(treap_t *treap, int value)
+{
+	binary_tree_t *node;
+
+	if (!treap)
+		return (NULL);
+	node = bst_insert(&treap->root, value);
+	if (!node)
+		return (NULL);
+	node->priority = treap_priority(treap);
+	while (node->parent && node->parent->priority < node->priority)
+	{
+		if (node->parent->left == node)
+			binary_tree_rotate_right(node->parent);
+		else
+			binary_tree_rotate_left(node->parent);
+	}
+	if (!node->parent)
+		treap->root = node;
+	return (node);
+}
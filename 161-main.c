@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    treap_t treap = {NULL, 98};
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    int remove[] = {47, 79, 32, 62, 1};
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        treap_insert(&treap, array[i]);
+    binary_tree_print(treap.root);
+    for (i = 0; i < sizeof(remove) / sizeof(remove[0]); i++)
+    {
+        treap_remove(&treap, remove[i]);
+        printf("Removed %d\n", remove[i]);
+        binary_tree_print(treap.root);
+    }
+    binary_tree_delete(treap.root);
+    return (0);
+}
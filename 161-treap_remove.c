@@ -0,0 +1,35 @@
+#include "binary_trees.h"
+/**
+* treap_remove - removes a node from a Treap
+* @treap: pointer to the treap handle for removing a node
+* @value: value to remove in the treap
+* Return: pointer to the new root of the treap after removing the value
+*/
+binary_tree_t *treap_remove(treap_t *treap, int value)
+{
+	binary_tree_t *node, *up;
+
+	if (!treap)
+		return (NULL);
+	node = bst_search(treap->root, value);
+	if (!node)
+		return (treap->root);
+	while (node->left || node->right)
+	{
+		if (!node->right || (node->left &&
+			node->left->priority > node->right->priority))
+			up = binary_tree_rotate_right(node);
+		else
+			up = binary_tree_rotate_left(node);
+		if (!up->parent)
+			treap->root = up;
+	}
+	if (!node->parent)
+		treap->root = NULL;
+	else if (node->parent->left == node)
+		node->parent->left = NULL;
+	else
+		node->parent->right = NULL;
+	free(node);
+	return (treap->root);
+}
@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    treap_t treap = {NULL, 98};
+    treap_t upper = {NULL, 402};
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68,
+        79, 84, 87, 91, 95, 98
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        treap_insert(&treap, array[i]);
+    binary_tree_print(treap.root);
+    treap_split(&treap, 50, &upper);
+    printf("Below 50:\n");
+    binary_tree_print(treap.root);
+    printf("From 50:\n");
+    binary_tree_print(upper.root);
+    binary_tree_delete(treap.root);
+    binary_tree_delete(upper.root);
+    return (0);
+}
@@ -0,0 +1,52 @@
+#include "binary_trees.h"
+/**
+* treap_split_nodes - splits a treap subtree around a key
+* @node: pointer to the root node of the subtree to split
+* @key: values greater than or equal to key go to the right part
+* @left: address receiving the root of the lower part
+* @right: address receiving the root of the upper part
+* Return: void
+*/
+void treap_split_nodes(binary_tree_t *node, int key,
+		binary_tree_t **left, binary_tree_t **right)
+{
+	if (!node)
+	{
+		*left = NULL;
+		*right = NULL;
+		return;
+	}
+	if (node->n < key)
+	{
+		treap_split_nodes(node->right, key, &node->right, right);
+		if (node->right)
+			node->right->parent = node;
+		*left = node;
+	}
+	else
+	{
+		treap_split_nodes(node->left, key, left, &node->left);
+		if (node->left)
+			node->left->parent = node;
+		*right = node;
+	}
+}
+/**
+* treap_split - splits a Treap around a key
+* @treap: pointer to the treap handle to split, keeps the values below key
+* @key: values greater than or equal to key move to right
+* @right: pointer to an empty treap handle receiving the upper part
+* Return: pointer to the root of the upper part, or NULL if it is empty or
+* right is not empty
+*/
+binary_tree_t *treap_split(treap_t *treap, int key, treap_t *right)
+{
+	if (!treap || !right || right->root)
+		return (NULL);
+	treap_split_nodes(treap->root, key, &treap->root, &right->root);
+	if (treap->root)
+		treap->root->parent = NULL;
+	if (right->root)
+		right->root->parent = NULL;
+	return (right->root);
+}
@@ -0,0 +1,31 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    treap_t lower = {NULL, 98};
+    treap_t upper = {NULL, 402};
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68,
+        79, 84, 87, 91, 95, 98
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        treap_insert(i < n / 2 ? &lower : &upper, array[i]);
+    binary_tree_print(lower.root);
+    binary_tree_print(upper.root);
+    treap_merge(&lower, &upper);
+    printf("Merged:\n");
+    binary_tree_print(lower.root);
+    printf("Is %d bst: %d\n", lower.root->n, binary_tree_is_bst(lower.root));
+    binary_tree_delete(lower.root);
+    return (0);
+}
@@ -0,0 +1,39 @@
+#include "binary_trees.h"
+/**
+* treap_merge_nodes - joins two treap subtrees whose values do not overlap
+* @left: pointer to the root node of the subtree with the smaller values
+* @right: pointer to the root node of the subtree with the greater values
+* Return: pointer to the root node of the merged subtree
+*/
+binary_tree_t *treap_merge_nodes(binary_tree_t *left, binary_tree_t *right)
+{
+	if (!left)
+		return (right);
+	if (!right)
+		return (left);
+	if (left->priority > right->priority)
+	{
+		left->right = treap_merge_nodes(left->right, right);
+		left->right->parent = left;
+		return (left);
+	}
+	right->left = treap_merge_nodes(left, right->left);
+	right->left->parent = right;
+	return (right);
+}
+/**
+* treap_merge - joins two Treaps whose values do not overlap
+* @left: pointer to the treap handle with the smaller values, receives all
+* @right: pointer to the treap handle with the greater values, left empty
+* Return: pointer to the root of the merged treap
+*/
+binary_tree_t *treap_merge(treap_t *left, treap_t *right)
+{
+	if (!left || !right)
+		return (NULL);
+	left->root = treap_merge_nodes(left->root, right->root);
+	if (left->root)
+		left->root->parent = NULL;
+	right->root = NULL;
+	return (left->root);
+}
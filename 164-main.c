@@ -0,0 +1,25 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    treap_t treap = {NULL, 98};
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68,
+        79, 84, 87, 91, 95, 98
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    if (!sorted_array_to_treap(&treap, array, n))
+        return (1);
+    binary_tree_print(treap.root);
+    printf("Is %d bst: %d\n", treap.root->n, binary_tree_is_bst(treap.root));
+    binary_tree_delete(treap.root);
+    return (0);
+}
@@ -0,0 +1,44 @@
+#include "binary_trees.h"
+/**
+* sorted_array_to_treap - builds a Treap from a sorted array in O(n)
+* @treap: pointer to an empty treap handle receiving the values
+* @array: pointer to the first element of the sorted array
+* @size: number of elements in the array
+* Return: pointer to the root node of the created treap, or NULL on failure
+*
+* Description: Cartesian tree construction; the right spine, linked through
+* the parent pointers, is the stack of the nodes still open on the right.
+*/
+binary_tree_t *sorted_array_to_treap(treap_t *treap, int *array, size_t size)
+{
+	binary_tree_t *last = NULL, *node, *child;
+	size_t i;
+
+	if (!treap || !array || treap->root)
+		return (NULL);
+	for (i = 0; i < size; i++)
+	{
+		if (last && array[i] <= last->n)
+			continue;
+		node = binary_tree_node(NULL, array[i]);
+		if (!node)
+		{
+			binary_tree_delete(treap->root);
+			return (treap->root = NULL);
+		}
+		node->priority = treap_priority(treap);
+		for (child = NULL; last && last->priority < node->priority;
+			last = last->parent)
+			child = last;
+		node->left = child;
+		if (child)
+			child->parent = node;
+		node->parent = last;
+		if (last)
+			last->right = node;
+		else
+			treap->root = node;
+		last = node;
+	}
+	return (treap->root);
+}
@@ -0,0 +1,29 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    scapegoat_t tree = {NULL, 0, 0};
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree.root = array_to_bst(array, n);
+    tree.size = tree.max_size = n;
+    binary_tree_print(tree.root);
+    scapegoat_rebuild(&tree, tree.root->right->right);
+    printf("Rebuilt from %d\n", array[2]);
+    binary_tree_print(tree.root);
+    scapegoat_rebuild(&tree, tree.root);
+    printf("Rebuilt from root\n");
+    binary_tree_print(tree.root);
+    binary_tree_delete(tree.root);
+    return (0);
+}
@@ -0,0 +1,50 @@
+#include "binary_trees.h"
+/**
+* scapegoat_flatten - stores the values of a subtree in order
+* @tree: pointer to the root node of the subtree to flatten
+* @array: array receiving the values
+* @i: index of the next free slot in array
+* Return: index of the next free slot once the subtree is stored
+*/
+size_t scapegoat_flatten(const bst_t *tree, int *array, size_t i)
+{
+	if (!tree)
+		return (i);
+	i = scapegoat_flatten(tree->left, array, i);
+	array[i++] = tree->n;
+	return (scapegoat_flatten(tree->right, array, i));
+}
+/**
+* scapegoat_rebuild - rebuilds a Scapegoat Tree subtree to perfect balance
+* @tree: pointer to the scapegoat tree handle
+* @node: pointer to the root node of the subtree to rebuild
+* Return: pointer to the root node of the rebuilt subtree, or NULL on failure
+*/
+bst_t *scapegoat_rebuild(scapegoat_t *tree, bst_t *node)
+{
+	bst_t *parent, *rebuilt;
+	int *array;
+	size_t size;
+
+	if (!tree || !node)
+		return (NULL);
+	size = binary_tree_size(node);
+	array = malloc(sizeof(*array) * size);
+	if (!array)
+		return (NULL);
+	scapegoat_flatten(node, array, 0);
+	rebuilt = sorted_array_to_avl(array, size);
+	free(array);
+	if (!rebuilt)
+		return (NULL);
+	parent = node->parent;
+	rebuilt->parent = parent;
+	if (!parent)
+		tree->root = rebuilt;
+	else if (parent->left == node)
+		parent->left = rebuilt;
+	else
+		parent->right = rebuilt;
+	binary_tree_delete(node);
+	return (rebuilt);
+}
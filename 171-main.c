@@ -0,0 +1,27 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    scapegoat_t tree = {NULL, 0, 0};
+    bst_t *node;
+    int i;
+
+    for (i = 1; i <= 16; i++)
+    {
+        node = scapegoat_insert(&tree, i * 10);
+        printf("%sInserted: %d\n", i > 1 ? "\n" : "", node->n);
+        binary_tree_print(tree.root);
+    }
+    printf("Size: %lu, height: %lu, is bst: %d\n", (unsigned long)tree.size,
+           (unsigned long)binary_tree_height(tree.root),
+           binary_tree_is_bst(tree.root));
+    binary_tree_delete(tree.root);
+    return (0);
+}
@@ -0,0 +1,53 @@
+#include "binary_trees.h"
+/**
+* scapegoat_depth_limit - computes the deepest depth allowed for a size,
+* floor(log(size) / log(3/2)) for an alpha of 2/3
+* @size: number of nodes in the tree
+* Return: the depth limit
+*/
+size_t scapegoat_depth_limit(size_t size)
+{
+	size_t limit = 0;
+	double bound = 1.5;
+
+	while (bound <= size)
+	{
+		bound *= 1.5;
+		limit++;
+	}
+	return (limit);
+}
+/**
+* scapegoat_insert - inserts a value in a Scapegoat Tree
+* @tree: pointer to the scapegoat tree handle to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+bst_t *scapegoat_insert(scapegoat_t *tree, int value)
+{
+	bst_t *node, *child, *goat, *rebuilt;
+	size_t size, child_size;
+
+	if (!tree)
+		return (NULL);
+	node = bst_insert(&tree->root, value);
+	if (!node)
+		return (NULL);
+	if (++tree->size > tree->max_size)
+		tree->max_size = tree->size;
+	if (binary_tree_depth(node) <= scapegoat_depth_limit(tree->size))
+		return (node);
+	for (child = node, child_size = 1; child->parent; child = goat)
+	{
+		goat = child->parent;
+		size = child_size + 1 + binary_tree_size(goat->left == child ?
+			goat->right : goat->left);
+		if (3 * child_size > 2 * size)
+			break;
+		child_size = size;
+	}
+	if (!child->parent)
+		return (node);
+	rebuilt = scapegoat_rebuild(tree, child->parent);
+	return (rebuilt ? bst_search(rebuilt, value) : node);
+}
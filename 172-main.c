@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    scapegoat_t tree = {NULL, 0, 0};
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    int remove[] = {47, 79, 32, 62, 1, 2, 20};
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        scapegoat_insert(&tree, array[i]);
+    binary_tree_print(tree.root);
+    for (i = 0; i < sizeof(remove) / sizeof(remove[0]); i++)
+    {
+        scapegoat_remove(&tree, remove[i]);
+        printf("Removed %d, size %lu\n", remove[i], (unsigned long)tree.size);
+        binary_tree_print(tree.root);
+    }
+    binary_tree_delete(tree.root);
+    return (0);
+}
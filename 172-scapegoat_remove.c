@@ -0,0 +1,24 @@
+#include "binary_trees.h"
+/**
+* scapegoat_remove - removes a node from a Scapegoat Tree
+* @tree: pointer to the scapegoat tree handle for removing a node
+* @value: value to remove in the tree
+* Return: pointer to the new root of the tree after removing the value
+*/
+bst_t *scapegoat_remove(scapegoat_t *tree, int value)
+{
+	if (!tree)
+		return (NULL);
+	if (!bst_search(tree->root, value))
+		return (tree->root);
+	tree->root = bst_remove(tree->root, value);
+	tree->size--;
+	if (!tree->root)
+		tree->max_size = 0;
+	else if (3 * tree->size < 2 * tree->max_size)
+	{
+		scapegoat_rebuild(tree, tree->root);
+		tree->max_size = tree->size;
+	}
+	return (tree->root);
+}
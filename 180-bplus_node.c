@@ -0,0 +1,36 @@
+#include "binary_trees.h"
+/**
+* bplus_node - creates an empty B+ tree node aligned on a cache line
+* @leaf: 1 to create a leaf, 0 to create an internal node
+* Return: pointer to the new node, or NULL on failure
+*/
+bplus_t *bplus_node(int leaf)
+{
+	void *mem;
+	bplus_t *node;
+
+	if (posix_memalign(&mem, 64, sizeof(bplus_t)))
+		return (NULL);
+	node = mem;
+	node->count = 0;
+	node->leaf = leaf;
+	node->next = NULL;
+	node->children[0] = NULL;
+	return (node);
+}
+/**
+* bplus_delete - deletes an entire B+ tree
+* @tree: pointer to the root node of the tree to delete
+* Return: void
+*/
+void bplus_delete(bplus_t *tree)
+{
+	int i;
+
+	if (!tree)
+		return;
+	if (!tree->leaf)
+		for (i = 0; i <= tree->count; i++)
+			bplus_delete(tree->children[i]);
+	free(tree);
+}
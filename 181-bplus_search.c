@@ -0,0 +1,37 @@
+#include "binary_trees.h"
+/**
+* bplus_child_index - finds the child of an internal node covering a value
+* @node: pointer to the internal node
+* @value: value to locate
+* Return: index of the child to descend into
+*
+* Description: the keys fit in one cache line, so a branch-free count of
+* the separators not greater than value beats a binary search.
+*/
+int bplus_child_index(const bplus_t *node, int value)
+{
+	int i, index = 0;
+
+	for (i = 0; i < node->count; i++)
+		index += (node->keys[i] <= value);
+	return (index);
+}
+/**
+* bplus_search - searches for a value in a B+ tree
+* @tree: pointer to the root node of the B+ tree to search
+* @value: value to search in the tree
+* Return: pointer to the leaf holding value, or NULL if it is not found
+*/
+bplus_t *bplus_search(const bplus_t *tree, int value)
+{
+	int i;
+
+	if (!tree)
+		return (NULL);
+	while (!tree->leaf)
+		tree = tree->children[bplus_child_index(tree, value)];
+	for (i = 0; i < tree->count; i++)
+		if (tree->keys[i] == value)
+			return ((bplus_t *)tree);
+	return (NULL);
+}
@@ -0,0 +1,25 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bplus_t *root;
+    int array[100];
+    int i;
+
+    for (i = 0; i < 100; i++)
+        array[i] = i * 2;
+    root = sorted_array_to_bplus(array, 100);
+    printf("Root keys: %d, leaf: %d\n", root->count, root->leaf);
+    printf("Search 42: %s\n", bplus_search(root, 42) ? "found" : "not found");
+    printf("Search 43: %s\n", bplus_search(root, 43) ? "found" : "not found");
+    printf("Search 198: %s\n", bplus_search(root, 198) ? "found" : "not found");
+    bplus_delete(root);
+    return (0);
+}
@@ -0,0 +1,104 @@
+#include "binary_trees.h"
+#include <string.h>
+/**
+* bplus_split_child - splits the full child of a B+ tree node in two
+* @parent: pointer to the non-full parent node
+* @i: index of the full child in parent
+* Return: 1 on success, 0 on failure
+*/
+int bplus_split_child(bplus_t *parent, int i)
+{
+	bplus_t *child = parent->children[i], *sibling;
+	int half = BPLUS_ORDER / 2, sep;
+
+	sibling = bplus_node(child->leaf);
+	if (!sibling)
+		return (0);
+	sibling->count = BPLUS_ORDER - half;
+	memcpy(sibling->keys, child->keys + half, sizeof(int) * sibling->count);
+	sep = child->keys[half];
+	if (child->leaf)
+	{
+		sibling->next = child->next;
+		child->next = sibling;
+	}
+	else
+	{
+		sibling->count--;
+		memmove(sibling->keys, sibling->keys + 1,
+			sizeof(int) * sibling->count);
+		memcpy(sibling->children, child->children + half + 1,
+			sizeof(bplus_t *) * (sibling->count + 1));
+	}
+	child->count = half;
+	memmove(parent->keys + i + 1, parent->keys + i,
+		sizeof(int) * (parent->count - i));
+	memmove(parent->children + i + 2, parent->children + i + 1,
+		sizeof(bplus_t *) * (parent->count - i));
+	parent->keys[i] = sep;
+	parent->children[i + 1] = sibling;
+	parent->count++;
+	return (1);
+}
+/**
+* bplus_grow - gives a B+ tree a new root when the current one is full
+* @tree: double pointer to the root node of the B+ tree
+* Return: 1 on success, 0 on failure
+*/
+int bplus_grow(bplus_t **tree)
+{
+	bplus_t *root;
+
+	root = bplus_node(0);
+	if (!root)
+		return (0);
+	root->children[0] = *tree;
+	if (!bplus_split_child(root, 0))
+	{
+		free(root);
+		return (0);
+	}
+	*tree = root;
+	return (1);
+}
+/**
+* bplus_insert - inserts a value in a B+ tree
+* @tree: double pointer to the root node of the B+ tree to insert the value
+* @value: value to insert in the tree
+* Return: pointer to the leaf holding the value, or NULL on failure or
+* duplicate value
+*
+* Description: full nodes are split on the way down, so a failed allocation
+* never leaves the tree half-updated.
+*/
+bplus_t *bplus_insert(bplus_t **tree, int value)
+{
+	bplus_t *node;
+	int i;
+
+	if (!tree)
+		return (NULL);
+	if (!*tree && !(*tree = bplus_node(1)))
+		return (NULL);
+	if ((*tree)->count == BPLUS_ORDER && !bplus_grow(tree))
+		return (NULL);
+	for (node = *tree; !node->leaf; node = node->children[i])
+	{
+		i = bplus_child_index(node, value);
+		if (node->children[i]->count == BPLUS_ORDER)
+		{
+			if (!bplus_split_child(node, i))
+				return (NULL);
+			i += (value >= node->keys[i]);
+		}
+	}
+	for (i = 0; i < node->count && node->keys[i] < value; i++)
+		;
+	if (i < node->count && node->keys[i] == value)
+		return (NULL);
+	memmove(node->keys + i + 1, node->keys + i,
+		sizeof(int) * (node->count - i));
+	node->keys[i] = value;
+	node->count++;
+	return (node);
+}
@@ -0,0 +1,37 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_num - Prints a number
+ *
+ * @n: Number to be printed
+ */
+void print_num(int n)
+{
+    printf("%d ", n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bplus_t *root = NULL;
+    bplus_t *leaf;
+    int i;
+
+    for (i = 0; i < 40; i++)
+        bplus_insert(&root, (i * 37) % 101);
+    leaf = bplus_insert(&root, 74);
+    printf("Duplicate 74: %p\n", (void *)leaf);
+    leaf = bplus_insert(&root, 1000);
+    printf("Inserted 1000 in a leaf of %d keys\n", leaf->count);
+    printf("Root keys: %d, leaf: %d\n", root->count, root->leaf);
+    bplus_range(root, 0, 2000, print_num);
+    printf("\n");
+    bplus_delete(root);
+    return (0);
+}
@@ -0,0 +1,146 @@
+#include "binary_trees.h"
+#include <string.h>
+/**
+* bplus_borrow_left - moves the last key of a left sibling into a child
+* @parent: pointer to the parent node
+* @i: index of the child receiving the key, greater than 0
+* Return: void
+*/
+void bplus_borrow_left(bplus_t *parent, int i)
+{
+	bplus_t *child = parent->children[i], *left = parent->children[i - 1];
+
+	memmove(child->keys + 1, child->keys, sizeof(int) * child->count);
+	if (child->leaf)
+	{
+		child->keys[0] = left->keys[left->count - 1];
+		parent->keys[i - 1] = child->keys[0];
+	}
+	else
+	{
+		memmove(child->children + 1, child->children,
+			sizeof(bplus_t *) * (child->count + 1));
+		child->keys[0] = parent->keys[i - 1];
+		child->children[0] = left->children[left->count];
+		parent->keys[i - 1] = left->keys[left->count - 1];
+	}
+	child->count++;
+	left->count--;
+}
+/**
+* bplus_borrow_right - moves the first key of a right sibling into a child
+* @parent: pointer to the parent node
+* @i: index of the child receiving the key, less than parent->count
+* Return: void
+*/
+void bplus_borrow_right(bplus_t *parent, int i)
+{
+	bplus_t *child = parent->children[i], *right = parent->children[i + 1];
+
+	if (child->leaf)
+	{
+		child->keys[child->count] = right->keys[0];
+		parent->keys[i] = right->keys[1];
+	}
+	else
+	{
+		child->keys[child->count] = parent->keys[i];
+		child->children[child->count + 1] = right->children[0];
+		parent->keys[i] = right->keys[0];
+		memmove(right->children, right->children + 1,
+			sizeof(bplus_t *) * right->count);
+	}
+	memmove(right->keys, right->keys + 1, sizeof(int) * (right->count - 1));
+	child->count++;
+	right->count--;
+}
+/**
+* bplus_merge - merges a child of a B+ tree node with its right sibling
+* @parent: pointer to the parent node
+* @i: index of the left child of the pair to merge
+* Return: pointer to the merged child
+*/
+bplus_t *bplus_merge(bplus_t *parent, int i)
+{
+	bplus_t *left = parent->children[i], *right = parent->children[i + 1];
+
+	if (left->leaf)
+		left->next = right->next;
+	else
+	{
+		left->keys[left->count++] = parent->keys[i];
+		memcpy(left->children + left->count, right->children,
+			sizeof(bplus_t *) * (right->count + 1));
+	}
+	memcpy(left->keys + left->count, right->keys,
+		sizeof(int) * right->count);
+	left->count += right->count;
+	free(right);
+	memmove(parent->keys + i, parent->keys + i + 1,
+		sizeof(int) * (parent->count - i - 1));
+	memmove(parent->children + i + 1, parent->children + i + 2,
+		sizeof(bplus_t *) * (parent->count - i - 1));
+	parent->count--;
+	return (left);
+}
+/**
+* bplus_fill_child - makes sure a child holds more than BPLUS_MIN keys
+* before the removal descends into it
+* @parent: pointer to the parent node
+* @i: index of the child to fill
+* Return: pointer to the child to descend into
+*/
+bplus_t *bplus_fill_child(bplus_t *parent, int i)
+{
+	if (parent->children[i]->count > BPLUS_MIN)
+		return (parent->children[i]);
+	if (i > 0 && parent->children[i - 1]->count > BPLUS_MIN)
+		bplus_borrow_left(parent, i);
+	else if (i < parent->count &&
+		parent->children[i + 1]->count > BPLUS_MIN)
+		bplus_borrow_right(parent, i);
+	else if (i > 0)
+		return (bplus_merge(parent, i - 1));
+	else
+		return (bplus_merge(parent, i));
+	return (parent->children[i]);
+}
+/**
+* bplus_remove - removes a value from a B+ tree
+* @root: pointer to the root node of the tree for removing a value
+* @value: value to remove in the tree
+* Return: pointer to the new root of the tree after removing the value
+*
+* Description: underfull children are refilled on the way down, so the leaf
+* reached can always give up a key.
+*/
+bplus_t *bplus_remove(bplus_t *root, int value)
+{
+	bplus_t *node, *old;
+	int i;
+
+	for (node = root; node && !node->leaf;)
+	{
+		node = bplus_fill_child(node, bplus_child_index(node, value));
+		if (!root->count)
+		{
+			old = root;
+			root = root->children[0];
+			free(old);
+		}
+	}
+	if (!node)
+		return (NULL);
+	for (i = 0; i < node->count && node->keys[i] != value; i++)
+		;
+	if (i == node->count)
+		return (root);
+	memmove(node->keys + i, node->keys + i + 1,
+		sizeof(int) * (node->count - i - 1));
+	if (--node->count == 0 && node == root)
+	{
+		free(root);
+		return (NULL);
+	}
+	return (root);
+}
@@ -0,0 +1,35 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_num - Prints a number
+ *
+ * @n: Number to be printed
+ */
+void print_num(int n)
+{
+    printf("%d ", n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bplus_t *root = NULL;
+    int i;
+
+    for (i = 0; i < 50; i++)
+        bplus_insert(&root, i);
+    for (i = 0; i < 50; i += 3)
+        root = bplus_remove(root, i);
+    bplus_range(root, 0, 50, print_num);
+    printf("\nRoot keys: %d, leaf: %d\n", root->count, root->leaf);
+    for (i = 0; i < 50; i++)
+        root = bplus_remove(root, i);
+    printf("Empty: %p\n", (void *)root);
+    return (0);
+}
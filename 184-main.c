@@ -0,0 +1,31 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bplus_t *root;
+    bplus_t *leaf;
+    int array[1000];
+    int i, leaves;
+
+    for (i = 0; i < 1000; i++)
+        array[i] = i;
+    root = sorted_array_to_bplus(array, 1000);
+    if (!root)
+        return (1);
+    printf("Root keys: %d\n", root->count);
+    for (leaf = root; !leaf->leaf; leaf = leaf->children[0])
+        ;
+    for (leaves = 0; leaf; leaf = leaf->next)
+        leaves++;
+    printf("Leaves: %d\n", leaves);
+    printf("Values: %lu\n", (unsigned long)bplus_range(root, 0, 999, NULL));
+    bplus_delete(root);
+    return (0);
+}
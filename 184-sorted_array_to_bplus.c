@@ -0,0 +1,138 @@
+#include "binary_trees.h"
+#include <string.h>
+/**
+* bplus_load_keys - copies the increasing keys of a sorted array
+* @array: pointer to the first element of the sorted array
+* @size: number of elements in the array, set to the number of keys kept
+* Return: array holding each key once, or NULL on failure
+*
+* Description: as sorted_array_to_treap does, a value not greater than the
+* last one kept, such as a duplicate, is skipped.
+*/
+int *bplus_load_keys(int *array, size_t *size)
+{
+	int *keys = malloc(sizeof(int) * *size);
+	size_t i, count = 0;
+
+	if (!keys)
+		return (NULL);
+	for (i = 0; i < *size; i++)
+		if (!count || array[i] > keys[count - 1])
+			keys[count++] = array[i];
+	*size = count;
+	return (keys);
+}
+/**
+* bplus_load_leaves - fills evenly sized, linked leaves from a sorted array
+* @level: array receiving the leaves
+* @mins: array receiving the smallest key of each leaf
+* @array: pointer to the first element of the sorted array
+* @size: number of elements in the array
+* Return: number of leaves, or 0 on failure
+*/
+size_t bplus_load_leaves(bplus_t **level, int *mins, int *array, size_t size)
+{
+	size_t count, i, start, end;
+
+	count = (size + BPLUS_ORDER - 1) / BPLUS_ORDER;
+	for (i = 0; i < count; i++)
+	{
+		start = size * i / count;
+		end = size * (i + 1) / count;
+		level[i] = bplus_node(1);
+		if (!level[i])
+		{
+			while (i)
+				free(level[--i]);
+			return (0);
+		}
+		level[i]->count = end - start;
+		memcpy(level[i]->keys, array + start,
+			sizeof(int) * (end - start));
+		mins[i] = array[start];
+		if (i)
+			level[i - 1]->next = level[i];
+	}
+	return (count);
+}
+/**
+* bplus_load_level - builds the parents of a level of B+ tree nodes
+* @level: array of the nodes of the level
+* @up: array receiving the parents
+* @mins: smallest key under each node, replaced by those of the parents
+* @size: number of nodes in the level
+* Return: number of parents, or 0 on failure
+*/
+size_t bplus_load_level(bplus_t **level, bplus_t **up, int *mins, size_t size)
+{
+	size_t count, i, j, start, end;
+
+	count = (size + BPLUS_ORDER) / (BPLUS_ORDER + 1);
+	for (i = 0; i < count; i++)
+	{
+		up[i] = bplus_node(0);
+		if (!up[i])
+		{
+			while (i)
+				free(up[--i]);
+			return (0);
+		}
+	}
+	for (i = 0; i < count; i++)
+	{
+		start = size * i / count;
+		end = size * (i + 1) / count;
+		for (j = start; j < end; j++)
+		{
+			up[i]->children[j - start] = level[j];
+			if (j > start)
+				up[i]->keys[j - start - 1] = mins[j];
+		}
+		up[i]->count = end - start - 1;
+		mins[i] = mins[start];
+	}
+	return (count);
+}
+/**
+* sorted_array_to_bplus - bulk loads a B+ tree from a sorted array
+* @array: pointer to the first element of the sorted array
+* @size: number of elements in the array
+* Return: pointer to the root node of the created B+ tree, or NULL on failure
+*
+* Description: the leaves are packed evenly and the levels are built
+* bottom-up in O(n), without any split. Duplicates are skipped.
+*/
+bplus_t *sorted_array_to_bplus(int *array, size_t size)
+{
+	bplus_t **level, **up, **tmp, *root = NULL;
+	int *mins, *keys;
+	size_t count = 0, next, i;
+
+	keys = array && size ? bplus_load_keys(array, &size) : NULL;
+	if (!keys)
+		return (NULL);
+	next = (size + BPLUS_ORDER - 1) / BPLUS_ORDER;
+	level = malloc(sizeof(*level) * next);
+	up = malloc(sizeof(*up) * next);
+	mins = malloc(sizeof(*mins) * next);
+	if (level && up && mins)
+		count = bplus_load_leaves(level, mins, keys, size);
+	free(keys);
+	while (count > 1)
+	{
+		next = bplus_load_level(level, up, mins, count);
+		if (!next)
+			for (i = 0; i < count; i++)
+				bplus_delete(level[i]);
+		tmp = level;
+		level = up;
+		up = tmp;
+		count = next;
+	}
+	if (count == 1)
+		root = level[0];
+	free(level);
+	free(up);
+	free(mins);
+	return (root);
+}
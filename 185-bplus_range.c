@@ -0,0 +1,36 @@
+#include "binary_trees.h"
+/**
+* bplus_range - goes through the values of a B+ tree within a range, in order
+* @tree: pointer to the root node of the B+ tree
+* @lo: smallest value of the range
+* @hi: greatest value of the range
+* @func: pointer to a function to call for each value, may be NULL
+* Return: number of values in the range
+*
+* Description: one descent finds the first leaf, then the scan follows the
+* leaf links sequentially.
+*/
+size_t bplus_range(const bplus_t *tree, int lo, int hi, void (*func)(int))
+{
+	size_t found = 0;
+	int i;
+
+	if (!tree || lo > hi)
+		return (0);
+	while (!tree->leaf)
+		tree = tree->children[bplus_child_index(tree, lo)];
+	for (i = 0; tree && i < tree->count && tree->keys[i] < lo; i++)
+		;
+	for (; tree; tree = tree->next, i = 0)
+	{
+		for (; i < tree->count; i++)
+		{
+			if (tree->keys[i] > hi)
+				return (found);
+			if (func)
+				func(tree->keys[i]);
+			found++;
+		}
+	}
+	return (found);
+}
@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_num - Prints a number
+ *
+ * @n: Number to be printed
+ */
+void print_num(int n)
+{
+    printf("%d ", n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bplus_t *root;
+    int array[200];
+    size_t found;
+    int i;
+
+    for (i = 0; i < 200; i++)
+        array[i] = i * 5;
+    root = sorted_array_to_bplus(array, 200);
+    found = bplus_range(root, 312, 401, print_num);
+    printf("\nFound: %lu\n", (unsigned long)found);
+    found = bplus_range(root, 996, 2000, print_num);
+    printf("\nFound: %lu\n", (unsigned long)found);
+    bplus_delete(root);
+    return (0);
+}
@@ -0,0 +1,90 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * report - prints one CSV line of the benchmark
+ * @tree: name of the tree
+ * @op: name of the operation
+ * @start: clock value at the start of the run
+ * @ops: number of operations performed
+ */
+void report(const char *tree, const char *op, clock_t start, size_t ops)
+{
+    printf("%s,%s,%lu,%.1f\n", tree, op, (unsigned long)ops,
+           (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / ops);
+}
+
+/**
+ * main - Benchmarks the B+ tree against the AVL functions
+ * @ac: argument count
+ * @av: av[1] is the optional number of keys of the search benchmark,
+ * av[2] the optional number of keys of the insert benchmark
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    bplus_t *bplus = NULL;
+    avl_t *avl = NULL;
+    size_t i, n = 1000000, inserts = 10000;
+    int *keys, *probes;
+    clock_t start;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    if (ac > 2)
+        inserts = strtoul(av[2], NULL, 10);
+    keys = malloc(sizeof(*keys) * n);
+    probes = malloc(sizeof(*probes) * n);
+    if (!keys || !probes || !n || inserts > n)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+    {
+        keys[i] = (int)i * 2;
+        probes[i] = rand() % (int)(2 * n);
+    }
+    printf("tree,op,count,ns_per_op\n");
+    start = clock();
+    for (i = 0; i < inserts; i++)
+        bplus_insert(&bplus, probes[i]);
+    report("bplus", "insert", start, inserts);
+    start = clock();
+    for (i = 0; i < inserts; i++)
+        avl_insert(&avl, probes[i]);
+    report("avl", "insert", start, inserts);
+    start = clock();
+    for (i = 0; i < inserts; i++)
+        bplus = bplus_remove(bplus, probes[i]);
+    report("bplus", "remove", start, inserts);
+    start = clock();
+    for (i = 0; i < inserts; i++)
+        avl = avl_remove(avl, probes[i]);
+    report("avl", "remove", start, inserts);
+
+    start = clock();
+    bplus = sorted_array_to_bplus(keys, n);
+    report("bplus", "bulk_load", start, n);
+    start = clock();
+    avl = sorted_array_to_avl(keys, n);
+    report("avl", "bulk_load", start, n);
+    start = clock();
+    for (i = 0; i < n; i++)
+        bplus_search(bplus, probes[i]);
+    report("bplus", "search", start, n);
+    start = clock();
+    for (i = 0; i < n; i++)
+        bst_search(avl, probes[i]);
+    report("avl", "search", start, n);
+    start = clock();
+    for (i = 0; i < n / 100; i++)
+        bplus_range(bplus, probes[i], probes[i] + 200, NULL);
+    report("bplus", "range_100", start, n / 100 ? n / 100 : 1);
+    bplus_delete(bplus);
+    binary_tree_delete(avl);
+    free(keys);
+    free(probes);
+    return (0);
+}
@@ -0,0 +1,95 @@
+#include "binary_trees.h"
+/**
+* cpool_init - initializes an empty compact node pool
+* @pool: pointer to the pool to initialize
+* @capacity: number of nodes to reserve
+* Return: 1 on success, 0 on failure
+*/
+int cpool_init(cpool_t *pool, unsigned int capacity)
+{
+	if (!pool || capacity >= CNODE_MAX)
+		return (0);
+	pool->capacity = capacity + 1;
+	pool->nodes = malloc(sizeof(cnode_t) * pool->capacity);
+	if (!pool->nodes)
+		return (0);
+	pool->nodes[CNODE_NIL].n = 0;
+	pool->nodes[CNODE_NIL].left = CNODE_NIL;
+	pool->nodes[CNODE_NIL].right = CNODE_NIL;
+	pool->nodes[CNODE_NIL].balance = 1;
+	pool->size = 1;
+	pool->free_list = CNODE_NIL;
+	pool->root = CNODE_NIL;
+	return (1);
+}
+/**
+* cpool_destroy - releases all the memory of a compact node pool
+* @pool: pointer to the pool to destroy
+* Return: void
+*/
+void cpool_destroy(cpool_t *pool)
+{
+	if (!pool)
+		return;
+	free(pool->nodes);
+	pool->nodes = NULL;
+	pool->size = 0;
+	pool->capacity = 0;
+	pool->free_list = CNODE_NIL;
+	pool->root = CNODE_NIL;
+}
+/**
+* cpool_node - creates a compact node, reusing released slots first
+* @pool: pointer to the pool to allocate from
+* @value: value to put in the new node
+* Return: index of the new node, or CNODE_NIL on failure
+*
+* Description: growing the pool may move it, so callers must hold on to
+* indexes and not to cnode_t pointers across this call.
+*/
+unsigned int cpool_node(cpool_t *pool, int value)
+{
+	unsigned int node, capacity;
+	cnode_t *nodes;
+
+	if (pool->free_list != CNODE_NIL)
+	{
+		node = pool->free_list;
+		pool->free_list = pool->nodes[node].left;
+	}
+	else
+	{
+		if (pool->size == pool->capacity)
+		{
+			if (pool->capacity > CNODE_MAX)
+				return (CNODE_NIL);
+			capacity = pool->capacity > CNODE_MAX / 2 ?
+				CNODE_MAX + 1 : pool->capacity * 2;
+			nodes = realloc(pool->nodes,
+				sizeof(cnode_t) * capacity);
+			if (!nodes)
+				return (CNODE_NIL);
+			pool->nodes = nodes;
+			pool->capacity = capacity;
+		}
+		node = pool->size++;
+	}
+	pool->nodes[node].n = value;
+	pool->nodes[node].left = CNODE_NIL;
+	pool->nodes[node].right = CNODE_NIL;
+	pool->nodes[node].balance = 1;
+	return (node);
+}
+/**
+* cpool_release - gives a compact node back to its pool
+* @pool: pointer to the pool owning the node
+* @node: index of the node to release
+* Return: void
+*/
+void cpool_release(cpool_t *pool, unsigned int node)
+{
+	if (!pool || node == CNODE_NIL)
+		return;
+	pool->nodes[node].left = pool->free_list;
+	pool->free_list = node;
+}
@@ -0,0 +1,35 @@
+#include "binary_trees.h"
+/**
+* cbst_insert - inserts a value in a compact Binary Search Tree
+* @pool: pointer to the pool holding the tree
+* @value: value to store in the node to be inserted
+* Return: index of the created node, or CNODE_NIL on failure or duplicate
+*/
+unsigned int cbst_insert(cpool_t *pool, int value)
+{
+	unsigned int current, next, node;
+
+	if (!pool)
+		return (CNODE_NIL);
+	current = pool->root;
+	while (current != CNODE_NIL)
+	{
+		if (value == pool->nodes[current].n)
+			return (CNODE_NIL);
+		next = value < pool->nodes[current].n ?
+			pool->nodes[current].left : pool->nodes[current].right;
+		if (next == CNODE_NIL)
+			break;
+		current = next;
+	}
+	node = cpool_node(pool, value);
+	if (node == CNODE_NIL)
+		return (CNODE_NIL);
+	if (current == CNODE_NIL)
+		pool->root = node;
+	else if (value < pool->nodes[current].n)
+		pool->nodes[current].left = node;
+	else
+		pool->nodes[current].right = node;
+	return (node);
+}
@@ -0,0 +1,33 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    cpool_t pool;
+    binary_tree_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    if (!cpool_init(&pool, n))
+        return (1);
+    for (i = 0; i < n; i++)
+        cbst_insert(&pool, array[i]);
+    printf("Node size: %lu bytes\n", (unsigned long)sizeof(cnode_t));
+    printf("Found 32 at index %u\n", cbst_search(&pool, 32));
+    cbst_remove(&pool, 68);
+    tree = cpool_to_tree(&pool);
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    cpool_destroy(&pool);
+    return (0);
+}
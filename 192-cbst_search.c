@@ -0,0 +1,19 @@
+#include "binary_trees.h"
+/**
+* cbst_search - searches for a value in a compact Binary Search Tree
+* @pool: pointer to the pool holding the tree
+* @value: value to search in the tree
+* Return: index of the node containing value, or CNODE_NIL if not found
+*/
+unsigned int cbst_search(const cpool_t *pool, int value)
+{
+	unsigned int current;
+
+	if (!pool)
+		return (CNODE_NIL);
+	current = pool->root;
+	while (current != CNODE_NIL && pool->nodes[current].n != value)
+		current = value < pool->nodes[current].n ?
+			pool->nodes[current].left : pool->nodes[current].right;
+	return (current);
+}
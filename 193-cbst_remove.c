@@ -0,0 +1,57 @@
+#include "binary_trees.h"
+/**
+* cbst_relink - replaces the link from a parent to one of its children
+* @pool: pointer to the pool holding the tree
+* @parent: index of the parent node, CNODE_NIL if node is the root
+* @node: index of the child node being replaced
+* @child: index of the node taking its place
+* Return: void
+*/
+void cbst_relink(cpool_t *pool, unsigned int parent, unsigned int node,
+		unsigned int child)
+{
+	if (parent == CNODE_NIL)
+		pool->root = child;
+	else if (pool->nodes[parent].left == node)
+		pool->nodes[parent].left = child;
+	else
+		pool->nodes[parent].right = child;
+}
+/**
+* cbst_remove - removes a node from a compact Binary Search Tree
+* @pool: pointer to the pool holding the tree
+* @value: value to remove in the tree
+* Return: index of the new root node of the tree
+*/
+unsigned int cbst_remove(cpool_t *pool, int value)
+{
+	unsigned int node, parent = CNODE_NIL, succ, succ_parent;
+	cnode_t *nodes;
+
+	if (!pool)
+		return (CNODE_NIL);
+	nodes = pool->nodes;
+	node = pool->root;
+	while (node != CNODE_NIL && nodes[node].n != value)
+	{
+		parent = node;
+		node = value < nodes[node].n ?
+			nodes[node].left : nodes[node].right;
+	}
+	if (node == CNODE_NIL)
+		return (pool->root);
+	if (nodes[node].left != CNODE_NIL && nodes[node].right != CNODE_NIL)
+	{
+		succ_parent = node;
+		for (succ = nodes[node].right; nodes[succ].left != CNODE_NIL;
+			succ = nodes[succ].left)
+			succ_parent = succ;
+		nodes[node].n = nodes[succ].n;
+		parent = succ_parent;
+		node = succ;
+	}
+	cbst_relink(pool, parent, node, nodes[node].left != CNODE_NIL ?
+		nodes[node].left : nodes[node].right);
+	cpool_release(pool, node);
+	return (pool->root);
+}
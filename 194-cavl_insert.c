@@ -0,0 +1,139 @@
+#include "binary_trees.h"
+/**
+* cavl_fix_left - rebalances a compact AVL subtree two levels left-heavy
+* @nodes: array of nodes of the pool
+* @node: index of the root node of the subtree
+* Return: index of the new root node of the subtree
+*/
+unsigned int cavl_fix_left(cnode_t *nodes, unsigned int node)
+{
+	unsigned int left = nodes[node].left, grand;
+	int gbf;
+
+	if (nodes[left].balance >= 1)
+	{
+		nodes[node].left = nodes[left].right;
+		nodes[left].right = node;
+		nodes[node].balance = nodes[left].balance == 1 ? 2 : 1;
+		nodes[left].balance = nodes[left].balance == 1 ? 0 : 1;
+		return (left);
+	}
+	grand = nodes[left].right;
+	gbf = (int)nodes[grand].balance - 1;
+	nodes[left].right = nodes[grand].left;
+	nodes[node].left = nodes[grand].right;
+	nodes[grand].left = left;
+	nodes[grand].right = node;
+	nodes[node].balance = gbf == 1 ? 0 : 1;
+	nodes[left].balance = gbf == -1 ? 2 : 1;
+	nodes[grand].balance = 1;
+	return (grand);
+}
+/**
+* cavl_fix_right - rebalances a compact AVL subtree two levels right-heavy
+* @nodes: array of nodes of the pool
+* @node: index of the root node of the subtree
+* Return: index of the new root node of the subtree
+*/
+unsigned int cavl_fix_right(cnode_t *nodes, unsigned int node)
+{
+	unsigned int right = nodes[node].right, grand;
+	int gbf;
+
+	if (nodes[right].balance <= 1)
+	{
+		nodes[node].right = nodes[right].left;
+		nodes[right].left = node;
+		nodes[node].balance = nodes[right].balance == 1 ? 0 : 1;
+		nodes[right].balance = nodes[right].balance == 1 ? 2 : 1;
+		return (right);
+	}
+	grand = nodes[right].left;
+	gbf = (int)nodes[grand].balance - 1;
+	nodes[node].right = nodes[grand].left;
+	nodes[right].left = nodes[grand].right;
+	nodes[grand].left = node;
+	nodes[grand].right = right;
+	nodes[node].balance = gbf == -1 ? 2 : 1;
+	nodes[right].balance = gbf == 1 ? 0 : 1;
+	nodes[grand].balance = 1;
+	return (grand);
+}
+/**
+* cavl_rebalance - rotates a compact AVL subtree whose balance factor is
+* out of range, keeping the stored balance factors exact
+* @pool: pointer to the pool holding the tree
+* @node: index of the root node of the subtree
+* @bf: balance factor of node, 2 or -2
+* Return: index of the new root node of the subtree
+*/
+unsigned int cavl_rebalance(cpool_t *pool, unsigned int node, int bf)
+{
+	if (bf > 1)
+		return (cavl_fix_left(pool->nodes, node));
+	if (bf < -1)
+		return (cavl_fix_right(pool->nodes, node));
+	pool->nodes[node].balance = bf + 1;
+	return (node);
+}
+/**
+* cavl_insert_node - inserts a value in a compact AVL subtree recursively
+* @pool: pointer to the pool holding the tree
+* @node: index of the root node of the subtree
+* @value: value to insert
+* @new: address receiving the index of the created node
+* @grew: address receiving 1 if the subtree got taller, 0 otherwise
+* Return: index of the new root node of the subtree
+*/
+unsigned int cavl_insert_node(cpool_t *pool, unsigned int node, int value,
+		unsigned int *new, int *grew)
+{
+	unsigned int child;
+	int bf;
+
+	if (node == CNODE_NIL)
+	{
+		*new = cpool_node(pool, value);
+		*grew = (*new != CNODE_NIL);
+		return (*new);
+	}
+	*grew = 0;
+	if (value == pool->nodes[node].n)
+		return (node);
+	if (value < pool->nodes[node].n)
+	{
+		child = cavl_insert_node(pool, pool->nodes[node].left, value,
+			new, grew);
+		pool->nodes[node].left = child;
+		bf = 1;
+	}
+	else
+	{
+		child = cavl_insert_node(pool, pool->nodes[node].right, value,
+			new, grew);
+		pool->nodes[node].right = child;
+		bf = -1;
+	}
+	if (!*grew)
+		return (node);
+	bf += (int)pool->nodes[node].balance - 1;
+	*grew = (bf == 1 || bf == -1);
+	return (cavl_rebalance(pool, node, bf));
+}
+/**
+* cavl_insert - inserts a value in a compact AVL tree
+* @pool: pointer to the pool holding the tree
+* @value: value to store in the node to be inserted
+* Return: index of the created node, or CNODE_NIL on failure or duplicate
+*/
+unsigned int cavl_insert(cpool_t *pool, int value)
+{
+	unsigned int new = CNODE_NIL, root;
+	int grew;
+
+	if (!pool)
+		return (CNODE_NIL);
+	root = cavl_insert_node(pool, pool->root, value, &new, &grew);
+	pool->root = root;
+	return (new);
+}
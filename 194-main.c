@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    cpool_t pool;
+    binary_tree_t *tree;
+    int i;
+
+    if (!cpool_init(&pool, 4))
+        return (1);
+    for (i = 1; i <= 20; i++)
+        cavl_insert(&pool, i * 10);
+    tree = cpool_to_tree(&pool);
+    binary_tree_print(tree);
+    printf("Is avl: %d\n", binary_tree_is_avl(tree));
+    binary_tree_delete(tree);
+    for (i = 1; i <= 20; i += 2)
+        cavl_remove(&pool, i * 10);
+    tree = cpool_to_tree(&pool);
+    binary_tree_print(tree);
+    printf("Is avl: %d\n", binary_tree_is_avl(tree));
+    binary_tree_delete(tree);
+    cpool_destroy(&pool);
+    return (0);
+}
@@ -0,0 +1,75 @@
+#include "binary_trees.h"
+/**
+* cavl_shrunk - updates a compact AVL node after one of its subtrees shrank
+* @pool: pointer to the pool holding the tree
+* @node: index of the node
+* @bf: change of the balance factor of node, 1 or -1
+* @shrank: address receiving 1 if the subtree of node got shorter
+* Return: index of the new root node of the subtree
+*/
+unsigned int cavl_shrunk(cpool_t *pool, unsigned int node, int bf,
+		int *shrank)
+{
+	bf += (int)pool->nodes[node].balance - 1;
+	node = cavl_rebalance(pool, node, bf);
+	*shrank = (pool->nodes[node].balance == 1);
+	return (node);
+}
+/**
+* cavl_remove_node - removes a value from a compact AVL subtree recursively
+* @pool: pointer to the pool holding the tree
+* @node: index of the root node of the subtree
+* @value: value to remove
+* @shrank: address receiving 1 if the subtree got shorter, 0 otherwise
+* Return: index of the new root node of the subtree
+*/
+unsigned int cavl_remove_node(cpool_t *pool, unsigned int node, int value,
+		int *shrank)
+{
+	unsigned int child;
+	cnode_t *nodes = pool->nodes;
+
+	*shrank = 0;
+	if (node == CNODE_NIL)
+		return (CNODE_NIL);
+	if (value == nodes[node].n && (nodes[node].left == CNODE_NIL ||
+		nodes[node].right == CNODE_NIL))
+	{
+		child = nodes[node].left != CNODE_NIL ?
+			nodes[node].left : nodes[node].right;
+		cpool_release(pool, node);
+		*shrank = 1;
+		return (child);
+	}
+	if (value < nodes[node].n)
+	{
+		child = cavl_remove_node(pool, nodes[node].left, value, shrank);
+		nodes[node].left = child;
+		return (*shrank ? cavl_shrunk(pool, node, -1, shrank) : node);
+	}
+	if (value == nodes[node].n)
+	{
+		for (child = nodes[node].right; nodes[child].left != CNODE_NIL;)
+			child = nodes[child].left;
+		value = nodes[child].n;
+		nodes[node].n = value;
+	}
+	child = cavl_remove_node(pool, nodes[node].right, value, shrank);
+	nodes[node].right = child;
+	return (*shrank ? cavl_shrunk(pool, node, 1, shrank) : node);
+}
+/**
+* cavl_remove - removes a node from a compact AVL tree
+* @pool: pointer to the pool holding the tree
+* @value: value to remove in the tree
+* Return: index of the new root node of the tree
+*/
+unsigned int cavl_remove(cpool_t *pool, int value)
+{
+	int shrank;
+
+	if (!pool)
+		return (CNODE_NIL);
+	pool->root = cavl_remove_node(pool, pool->root, value, &shrank);
+	return (pool->root);
+}
@@ -0,0 +1,92 @@
+#include "binary_trees.h"
+/**
+* cpool_copy - copies a binary subtree into a compact node pool
+* @pool: pointer to the pool receiving the nodes
+* @tree: pointer to the root node of the subtree to copy
+* @height: address receiving the height of the subtree, counting its root
+* Return: index of the copied root node, or CNODE_NIL on failure
+*/
+unsigned int cpool_copy(cpool_t *pool, const binary_tree_t *tree, int *height)
+{
+	unsigned int node, left, right;
+	int lh = 0, rh = 0;
+
+	*height = 0;
+	if (!tree)
+		return (CNODE_NIL);
+	node = cpool_node(pool, tree->n);
+	left = cpool_copy(pool, tree->left, &lh);
+	right = cpool_copy(pool, tree->right, &rh);
+	if (node == CNODE_NIL || (tree->left && left == CNODE_NIL) ||
+		(tree->right && right == CNODE_NIL))
+		return (CNODE_NIL);
+	pool->nodes[node].left = left;
+	pool->nodes[node].right = right;
+	if (lh - rh >= -1 && lh - rh <= 1)
+		pool->nodes[node].balance = lh - rh + 1;
+	*height = 1 + (lh > rh ? lh : rh);
+	return (node);
+}
+/**
+* cpool_from_tree - copies a binary tree into an empty compact node pool
+* @pool: pointer to the initialized, empty pool receiving the nodes
+* @tree: pointer to the root node of the tree to copy
+* Return: index of the root node in the pool, or CNODE_NIL on failure
+*
+* Description: the balance factors are only meaningful for an AVL tree.
+*/
+unsigned int cpool_from_tree(cpool_t *pool, const binary_tree_t *tree)
+{
+	int height;
+
+	if (!pool || !pool->nodes || pool->root != CNODE_NIL)
+		return (CNODE_NIL);
+	pool->root = cpool_copy(pool, tree, &height);
+	return (pool->root);
+}
+/**
+* cpool_tree - copies a compact subtree into new binary tree nodes
+* @pool: pointer to the pool holding the subtree
+* @node: index of the root node of the subtree
+* @parent: pointer to the parent of the node to create
+* Return: pointer to the created root node, or NULL on failure
+*/
+binary_tree_t *cpool_tree(const cpool_t *pool, unsigned int node,
+		binary_tree_t *parent)
+{
+	binary_tree_t *tree;
+
+	tree = binary_tree_node(parent, pool->nodes[node].n);
+	if (!tree)
+		return (NULL);
+	if (pool->nodes[node].left != CNODE_NIL)
+	{
+		tree->left = cpool_tree(pool, pool->nodes[node].left, tree);
+		if (!tree->left)
+		{
+			binary_tree_delete(tree);
+			return (NULL);
+		}
+	}
+	if (pool->nodes[node].right != CNODE_NIL)
+	{
+		tree->right = cpool_tree(pool, pool->nodes[node].right, tree);
+		if (!tree->right)
+		{
+			binary_tree_delete(tree);
+			return (NULL);
+		}
+	}
+	return (tree);
+}
+/**
+* cpool_to_tree - copies a compact tree into a new binary tree
+* @pool: pointer to the pool holding the tree
+* Return: pointer to the root node of the created tree, or NULL on failure
+*/
+binary_tree_t *cpool_to_tree(const cpool_t *pool)
+{
+	if (!pool || pool->root == CNODE_NIL)
+		return (NULL);
+	return (cpool_tree(pool, pool->root, NULL));
+}
@@ -0,0 +1,29 @@
+#include "binary_trees.h"
+/**
+* cheap_insert - inserts a value in a compact Max Binary Heap
+* @heap: pointer to the heap to insert the value
+* @value: value to insert in the heap
+* Return: pointer to the slot holding the value, or NULL on failure
+*/
+int *cheap_insert(cheap_t *heap, int value)
+{
+	size_t i, capacity;
+	int *keys;
+
+	if (!heap)
+		return (NULL);
+	if (heap->size == heap->capacity)
+	{
+		capacity = heap->capacity ? heap->capacity * 2 : 16;
+		keys = realloc(heap->keys, sizeof(int) * capacity);
+		if (!keys)
+			return (NULL);
+		heap->keys = keys;
+		heap->capacity = capacity;
+	}
+	for (i = heap->size++; i && heap->keys[(i - 1) / 2] < value;
+		i = (i - 1) / 2)
+		heap->keys[i] = heap->keys[(i - 1) / 2];
+	heap->keys[i] = value;
+	return (heap->keys + i);
+}
@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    cheap_t heap = {NULL, 0, 0};
+    heap_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        cheap_insert(&heap, array[i]);
+    tree = cheap_to_heap(&heap);
+    binary_tree_print(tree);
+    printf("Is heap: %d\n", binary_tree_is_heap(tree));
+    binary_tree_delete(tree);
+    for (i = 0; heap.size; i++)
+        printf("%s%d", i ? ", " : "", cheap_extract(&heap));
+    printf("\n");
+    free(heap.keys);
+    return (0);
+}
@@ -0,0 +1,27 @@
+#include "binary_trees.h"
+/**
+* cheap_extract - extracts the root value of a compact Max Binary Heap
+* @heap: pointer to the heap
+* Return: value stored at the root, 0 on failure
+*/
+int cheap_extract(cheap_t *heap)
+{
+	size_t i, child;
+	int value, last;
+
+	if (!heap || !heap->size)
+		return (0);
+	value = heap->keys[0];
+	last = heap->keys[--heap->size];
+	for (i = 0; (child = 2 * i + 1) < heap->size; i = child)
+	{
+		if (child + 1 < heap->size &&
+			heap->keys[child + 1] > heap->keys[child])
+			child++;
+		if (heap->keys[child] <= last)
+			break;
+		heap->keys[i] = heap->keys[child];
+	}
+	heap->keys[i] = last;
+	return (value);
+}
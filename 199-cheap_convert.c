@@ -0,0 +1,83 @@
+#include "binary_trees.h"
+/**
+* cheap_fill - stores a heap subtree at its level-order positions
+* @keys: array receiving the values
+* @size: number of values of the heap
+* @tree: pointer to the root node of the subtree
+* @i: level-order position of the root node of the subtree
+* Return: 1 on success, 0 if the tree is not complete
+*/
+int cheap_fill(int *keys, size_t size, const heap_t *tree, size_t i)
+{
+	if (!tree)
+		return (1);
+	if (i >= size)
+		return (0);
+	keys[i] = tree->n;
+	return (cheap_fill(keys, size, tree->left, 2 * i + 1) &&
+		cheap_fill(keys, size, tree->right, 2 * i + 2));
+}
+/**
+* cheap_from_heap - copies a Max Binary Heap into a compact heap
+* @heap: pointer to the empty compact heap receiving the values
+* @tree: pointer to the root node of the heap to copy
+* Return: 1 on success, 0 on failure
+*/
+int cheap_from_heap(cheap_t *heap, const heap_t *tree)
+{
+	size_t size;
+	int *keys;
+
+	if (!heap || heap->size)
+		return (0);
+	size = binary_tree_size(tree);
+	if (size > heap->capacity)
+	{
+		keys = realloc(heap->keys, sizeof(int) * size);
+		if (!keys)
+			return (0);
+		heap->keys = keys;
+		heap->capacity = size;
+	}
+	if (!cheap_fill(heap->keys, size, tree, 0))
+		return (0);
+	heap->size = size;
+	return (1);
+}
+/**
+* cheap_tree - copies the values of a compact heap from a position on
+* @heap: pointer to the compact heap
+* @i: level-order position of the value to copy
+* @parent: pointer to the parent of the node to create
+* Return: pointer to the created node, or NULL on failure
+*/
+heap_t *cheap_tree(const cheap_t *heap, size_t i, heap_t *parent)
+{
+	heap_t *node;
+
+	node = binary_tree_node(parent, heap->keys[i]);
+	if (!node)
+		return (NULL);
+	if (2 * i + 1 < heap->size)
+		node->left = cheap_tree(heap, 2 * i + 1, node);
+	if (2 * i + 2 < heap->size)
+		node->right = cheap_tree(heap, 2 * i + 2, node);
+	if ((2 * i + 1 < heap->size && !node->left) ||
+		(2 * i + 2 < heap->size && !node->right))
+	{
+		binary_tree_delete(node);
+		return (NULL);
+	}
+	return (node);
+}
+/**
+* cheap_to_heap - copies a compact heap into a new Max Binary Heap
+* @heap: pointer to the compact heap to copy
+* Return: pointer to the root node of the created heap, or NULL on failure
+*/
+heap_t *cheap_to_heap(const cheap_t *heap)
+{
+	if (!heap || !heap->size)
+		return (NULL);
+	return (cheap_tree(heap, 0, NULL));
+}
@@ -0,0 +1,31 @@
+#include "binary_trees.h"
+/**
+* lean_tree_node - creates a parentless binary tree node
+* @value: value to put in the new node
+* Return: pointer to the new node, or NULL on failure
+*/
+lean_tree_t *lean_tree_node(int value)
+{
+	lean_tree_t *new_node;
+
+	new_node = malloc(sizeof(lean_tree_t));
+	if (new_node == NULL)
+		return (NULL);
+	new_node->n = value;
+	new_node->left = NULL;
+	new_node->right = NULL;
+	return (new_node);
+}
+/**
+* lean_tree_delete - deletes an entire parentless binary tree
+* @tree: pointer to the root node of the tree to delete
+* Return: void
+*/
+void lean_tree_delete(lean_tree_t *tree)
+{
+	if (tree == NULL)
+		return;
+	lean_tree_delete(tree->left);
+	lean_tree_delete(tree->right);
+	free(tree);
+}
@@ -0,0 +1,23 @@
+#include "binary_trees.h"
+/**
+* lean_bst_insert - inserts a value in a parentless Binary Search Tree
+* @tree: double pointer to the root node of the BST to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+lean_tree_t *lean_bst_insert(lean_tree_t **tree, int value)
+{
+	lean_tree_t **link;
+
+	if (!tree)
+		return (NULL);
+	link = tree;
+	while (*link)
+	{
+		if (value == (*link)->n)
+			return (NULL);
+		link = value < (*link)->n ? &(*link)->left : &(*link)->right;
+	}
+	*link = lean_tree_node(value);
+	return (*link);
+}
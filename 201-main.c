@@ -0,0 +1,33 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    lean_tree_t *root = NULL;
+    binary_tree_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        lean_bst_insert(&root, array[i]);
+    printf("Node size: %lu bytes instead of %lu\n",
+           (unsigned long)sizeof(lean_tree_t),
+           (unsigned long)sizeof(binary_tree_t));
+    root->left = lean_rotate_right(root->left);
+    tree = lean_to_tree(root);
+    binary_tree_print(tree);
+    printf("Is bst: %d\n", binary_tree_is_bst(tree));
+    binary_tree_delete(tree);
+    lean_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,18 @@
+#include "binary_trees.h"
+/**
+* lean_rotate_left - performs a left-rotation on a parentless binary tree
+* @tree: pointer to the root node of the tree to rotate
+* Return: pointer to the new root node, for the caller to link in place of
+* tree
+*/
+lean_tree_t *lean_rotate_left(lean_tree_t *tree)
+{
+	lean_tree_t *new_root;
+
+	if (!tree || !tree->right)
+		return (NULL);
+	new_root = tree->right;
+	tree->right = new_root->left;
+	new_root->left = tree;
+	return (new_root);
+}
@@ -0,0 +1,18 @@
+#include "binary_trees.h"
+/**
+* lean_rotate_right - performs a right-rotation on a parentless binary tree
+* @tree: pointer to the root node of the tree to rotate
+* Return: pointer to the new root node, for the caller to link in place of
+* tree
+*/
+lean_tree_t *lean_rotate_right(lean_tree_t *tree)
+{
+	lean_tree_t *new_root;
+
+	if (!tree || !tree->left)
+		return (NULL);
+	new_root = tree->left;
+	tree->left = new_root->right;
+	new_root->right = tree;
+	return (new_root);
+}
@@ -0,0 +1,100 @@
+#include "binary_trees.h"
+/**
+* lean_path_push - pushes a node on a path stack
+* @path: pointer to the path
+* @node: node to push
+* Return: 1 on success, 0 on failure
+*/
+int lean_path_push(lean_path_t *path, lean_tree_t *node)
+{
+	lean_tree_t **nodes;
+	size_t capacity;
+
+	if (path->size == path->capacity)
+	{
+		capacity = path->capacity ? path->capacity * 2 : 32;
+		nodes = realloc(path->nodes, sizeof(*nodes) * capacity);
+		if (!nodes)
+			return (0);
+		path->nodes = nodes;
+		path->capacity = capacity;
+	}
+	path->nodes[path->size++] = node;
+	return (1);
+}
+/**
+* lean_path_free - releases the memory of a path stack
+* @path: pointer to the path
+* Return: void
+*/
+void lean_path_free(lean_path_t *path)
+{
+	if (!path)
+		return;
+	free(path->nodes);
+	path->nodes = NULL;
+	path->size = 0;
+	path->capacity = 0;
+}
+/**
+* lean_bst_path - records the path from the root of a parentless BST down
+* to a value
+* @root: pointer to the root node of the BST
+* @value: value to look for
+* @path: pointer to the path receiving the nodes
+* Return: 1 if the path ends on value, 0 otherwise
+*/
+int lean_bst_path(lean_tree_t *root, int value, lean_path_t *path)
+{
+	if (!path)
+		return (0);
+	path->size = 0;
+	while (root)
+	{
+		if (!lean_path_push(path, root))
+			return (0);
+		if (root->n == value)
+			return (1);
+		root = value < root->n ? root->left : root->right;
+	}
+	return (0);
+}
+/**
+* lean_tree_walk - pushes the nodes from a subtree root down to a node
+* @root: pointer to the root node of the subtree
+* @node: pointer to the node to reach
+* @path: pointer to the path receiving the nodes
+* Return: 1 if node was found, 0 otherwise
+*/
+int lean_tree_walk(lean_tree_t *root, const lean_tree_t *node,
+		lean_path_t *path)
+{
+	size_t size = path->size;
+
+	if (!root || !lean_path_push(path, root))
+		return (0);
+	if (root == node || lean_tree_walk(root->left, node, path) ||
+		lean_tree_walk(root->right, node, path))
+		return (1);
+	path->size = size;
+	return (0);
+}
+/**
+* lean_tree_path - records the path from the root of a parentless binary
+* tree down to one of its nodes
+* @root: pointer to the root node of the tree
+* @node: pointer to the node to reach
+* @path: pointer to the path receiving the nodes
+* Return: 1 if node was found, 0 otherwise
+*
+* Description: any binary tree may be searched, so this visits the nodes in
+* pre-order; prefer lean_bst_path on search trees.
+*/
+int lean_tree_path(lean_tree_t *root, const lean_tree_t *node,
+		lean_path_t *path)
+{
+	if (!path)
+		return (0);
+	path->size = 0;
+	return (lean_tree_walk(root, node, path));
+}
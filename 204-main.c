@@ -0,0 +1,39 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    lean_tree_t *root = NULL, *node;
+    lean_path_t first = {NULL, 0, 0};
+    lean_path_t second = {NULL, 0, 0};
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        lean_bst_insert(&root, array[i]);
+    lean_bst_path(root, 22, &first);
+    printf("Depth of 22: %lu\n", (unsigned long)lean_path_depth(&first));
+    node = lean_path_sibling(&first);
+    printf("Sibling of 22: %d\n", node ? node->n : -1);
+    node = lean_path_uncle(&first);
+    printf("Uncle of 22: %d\n", node ? node->n : -1);
+    lean_tree_path(root, root->left->right, &second);
+    printf("Depth of %d: %lu\n", root->left->right->n,
+           (unsigned long)lean_path_depth(&second));
+    node = lean_paths_ancestor(&first, &second);
+    printf("Ancestor of 22 and %d: %d\n", root->left->right->n, node->n);
+    lean_path_free(&first);
+    lean_path_free(&second);
+    lean_tree_delete(root);
+    return (0);
+}
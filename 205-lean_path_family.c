@@ -0,0 +1,65 @@
+#include "binary_trees.h"
+/**
+* lean_path_depth - measures the depth of the node ending a path
+* @path: pointer to the path
+* Return: depth of the node, or 0 if path is empty
+*/
+size_t lean_path_depth(const lean_path_t *path)
+{
+	if (!path || !path->size)
+		return (0);
+	return (path->size - 1);
+}
+/**
+* lean_path_sibling - finds the sibling of the node ending a path
+* @path: pointer to the path
+* Return: pointer to the sibling node, or NULL if the node has no sibling
+*/
+lean_tree_t *lean_path_sibling(const lean_path_t *path)
+{
+	lean_tree_t *node, *parent;
+
+	if (!path || path->size < 2)
+		return (NULL);
+	node = path->nodes[path->size - 1];
+	parent = path->nodes[path->size - 2];
+	if (parent->left == node)
+		return (parent->right);
+	return (parent->left);
+}
+/**
+* lean_path_uncle - finds the uncle of the node ending a path
+* @path: pointer to the path
+* Return: pointer to the uncle node, or NULL if the node has no uncle
+*/
+lean_tree_t *lean_path_uncle(const lean_path_t *path)
+{
+	lean_tree_t *parent, *grand;
+
+	if (!path || path->size < 3)
+		return (NULL);
+	parent = path->nodes[path->size - 2];
+	grand = path->nodes[path->size - 3];
+	if (grand->left == parent)
+		return (grand->right);
+	return (grand->left);
+}
+/**
+* lean_paths_ancestor - finds the lowest common ancestor of the nodes ending
+* two paths from the same root
+* @first: pointer to the path of the first node
+* @second: pointer to the path of the second node
+* Return: pointer to the lowest common ancestor, or NULL if there is none
+*/
+lean_tree_t *lean_paths_ancestor(const lean_path_t *first,
+		const lean_path_t *second)
+{
+	size_t i;
+
+	if (!first || !second)
+		return (NULL);
+	for (i = 0; i < first->size && i < second->size &&
+		first->nodes[i] == second->nodes[i]; i++)
+		;
+	return (i ? first->nodes[i - 1] : NULL);
+}
@@ -0,0 +1,60 @@
+#include "binary_trees.h"
+/**
+* lean_from_tree - copies a binary tree into parentless nodes
+* @tree: pointer to the root node of the tree to copy
+* Return: pointer to the root node of the copy, or NULL on failure
+*/
+lean_tree_t *lean_from_tree(const binary_tree_t *tree)
+{
+	lean_tree_t *copy;
+
+	if (!tree)
+		return (NULL);
+	copy = lean_tree_node(tree->n);
+	if (!copy)
+		return (NULL);
+	copy->left = lean_from_tree(tree->left);
+	copy->right = lean_from_tree(tree->right);
+	if ((tree->left && !copy->left) || (tree->right && !copy->right))
+	{
+		lean_tree_delete(copy);
+		return (NULL);
+	}
+	return (copy);
+}
+/**
+* lean_tree_copy - copies a parentless subtree into binary tree nodes
+* @tree: pointer to the root node of the subtree to copy
+* @parent: pointer to the parent of the node to create
+* Return: pointer to the root node of the copy, or NULL on failure
+*/
+binary_tree_t *lean_tree_copy(const lean_tree_t *tree, binary_tree_t *parent)
+{
+	binary_tree_t *copy;
+
+	copy = binary_tree_node(parent, tree->n);
+	if (!copy)
+		return (NULL);
+	if (tree->left)
+		copy->left = lean_tree_copy(tree->left, copy);
+	if (tree->right)
+		copy->right = lean_tree_copy(tree->right, copy);
+	if ((tree->left && !copy->left) || (tree->right && !copy->right))
+	{
+		binary_tree_delete(copy);
+		return (NULL);
+	}
+	return (copy);
+}
+/**
+* lean_to_tree - copies a parentless binary tree into binary tree nodes,
+* for instance to print it with binary_tree_print
+* @tree: pointer to the root node of the tree to copy
+* Return: pointer to the root node of the copy, or NULL on failure
+*/
+binary_tree_t *lean_to_tree(const lean_tree_t *tree)
+{
+	if (!tree)
+		return (NULL);
+	return (lean_tree_copy(tree, NULL));
+}
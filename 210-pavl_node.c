@@ -0,0 +1,54 @@
+#include "binary_trees.h"
+/**
+* pavl_node - creates a persistent AVL node owning its two children
+* @value: value to put in the new node
+* @left: reference to the left child, released on failure
+* @right: reference to the right child, released on failure
+* Return: pointer to the new node, or NULL on failure
+*/
+pavl_t *pavl_node(int value, pavl_t *left, pavl_t *right)
+{
+	pavl_t *node;
+	int lh = left ? left->height : 0, rh = right ? right->height : 0;
+
+	node = malloc(sizeof(pavl_t));
+	if (!node)
+	{
+		pavl_release(left);
+		pavl_release(right);
+		return (NULL);
+	}
+	node->n = value;
+	node->height = 1 + (lh > rh ? lh : rh);
+	node->refs = 1;
+	node->left = left;
+	node->right = right;
+	return (node);
+}
+/**
+* pavl_retain - takes a new reference to a persistent AVL version
+* @root: pointer to the root node of the version
+* Return: root
+*
+* Description: the count is atomic so that any thread may drop a version
+*/
+pavl_t *pavl_retain(pavl_t *root)
+{
+	if (root)
+		__atomic_add_fetch(&root->refs, 1, __ATOMIC_RELAXED);
+	return (root);
+}
+/**
+* pavl_release - drops a reference to a persistent AVL version, freeing
+* the nodes no other version shares
+* @root: pointer to the root node of the version
+* Return: void
+*/
+void pavl_release(pavl_t *root)
+{
+	if (!root || __atomic_sub_fetch(&root->refs, 1, __ATOMIC_ACQ_REL))
+		return;
+	pavl_release(root->left);
+	pavl_release(root->right);
+	free(root);
+}
@@ -0,0 +1,112 @@
+#include "binary_trees.h"
+/**
+* pavl_height - measures the height of a persistent AVL subtree
+* @tree: pointer to the root node of the subtree
+* Return: height of the subtree, 0 if it is NULL
+*/
+int pavl_height(const pavl_t *tree)
+{
+	return (tree ? tree->height : 0);
+}
+/**
+* pavl_join - builds the three nodes of a double rotation
+* @a: value of the new left node
+* @b: value of the new root node
+* @c: value of the new right node
+* @sub: the four subtrees in order, consumed
+* Return: pointer to the new root node, or NULL on failure
+*/
+pavl_t *pavl_join(int a, int b, int c, pavl_t **sub)
+{
+	pavl_t *left, *right;
+
+	left = pavl_node(a, sub[0], sub[1]);
+	right = pavl_node(c, sub[2], sub[3]);
+	if (!left || !right)
+	{
+		pavl_release(left);
+		pavl_release(right);
+		return (NULL);
+	}
+	return (pavl_node(b, left, right));
+}
+/**
+* pavl_fix_left - rebalances a value over a left subtree two levels higher
+* @value: value of the unbalanced node
+* @left: reference to the left subtree, consumed
+* @right: reference to the right subtree, consumed
+* Return: pointer to the new root node, or NULL on failure
+*/
+pavl_t *pavl_fix_left(int value, pavl_t *left, pavl_t *right)
+{
+	pavl_t *sub[4], *node;
+	int a = left->n, b = value, c;
+
+	if (pavl_height(left->left) >= pavl_height(left->right))
+	{
+		node = pavl_node(value, pavl_retain(left->right), right);
+		if (node)
+			node = pavl_node(a, pavl_retain(left->left), node);
+		pavl_release(left);
+		return (node);
+	}
+	sub[0] = pavl_retain(left->left);
+	sub[1] = pavl_retain(left->right->left);
+	sub[2] = pavl_retain(left->right->right);
+	sub[3] = right;
+	b = left->right->n;
+	c = value;
+	pavl_release(left);
+	return (pavl_join(a, b, c, sub));
+}
+/**
+* pavl_fix_right - rebalances a value over a right subtree two levels higher
+* @value: value of the unbalanced node
+* @left: reference to the left subtree, consumed
+* @right: reference to the right subtree, consumed
+* Return: pointer to the new root node, or NULL on failure
+*/
+pavl_t *pavl_fix_right(int value, pavl_t *left, pavl_t *right)
+{
+	pavl_t *sub[4], *node;
+	int a = value, b = right->n, c;
+
+	if (pavl_height(right->right) >= pavl_height(right->left))
+	{
+		node = pavl_node(value, left, pavl_retain(right->left));
+		if (node)
+			node = pavl_node(b, node, pavl_retain(right->right));
+		pavl_release(right);
+		return (node);
+	}
+	sub[0] = left;
+	sub[1] = pavl_retain(right->left->left);
+	sub[2] = pavl_retain(right->left->right);
+	sub[3] = pavl_retain(right->right);
+	b = right->left->n;
+	c = right->n;
+	pavl_release(right);
+	return (pavl_join(a, b, c, sub));
+}
+/**
+* pavl_make - creates a persistent AVL node over two subtrees, rotating
+* if their heights differ by two
+* @value: value to put in the node
+* @left: reference to the left subtree, consumed
+* @right: reference to the right subtree, consumed
+* Return: pointer to the root node of the balanced subtree, or NULL on
+* failure
+*
+* Description: shared nodes are never rotated in place; the rotated nodes
+* are rebuilt and the old ones released.
+*/
+pavl_t *pavl_make(int value, pavl_t *left, pavl_t *right)
+{
+	int bf = pavl_height(left) - pavl_height(right);
+
+	if (bf > 1)
+		return (pavl_fix_left(value, left, right));
+	if (bf < -1)
+		return (pavl_fix_right(value, left, right));
+	return (pavl_node(value, left, right));
+}
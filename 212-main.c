@@ -0,0 +1,50 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_version - Prints a persistent AVL version
+ *
+ * @root: Pointer to the root node of the version
+ */
+void print_version(const pavl_t *root)
+{
+    binary_tree_t *tree;
+
+    tree = pavl_to_tree(root);
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    pavl_t *versions[8];
+    int array[] = {
+        98, 402, 12, 46, 128, 256, 512, 50
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    versions[0] = NULL;
+    for (i = 1; i < n; i++)
+    {
+        versions[i] = pavl_insert(versions[i - 1], array[i - 1]);
+        if (!versions[i])
+            return (1);
+    }
+    printf("Version 4:\n");
+    print_version(versions[4]);
+    printf("Version 7:\n");
+    print_version(versions[7]);
+    printf("12 in version 2: %s\n",
+        pavl_search(versions[2], 12) ? "yes" : "no");
+    printf("Shared subtree: %d\n", versions[7]->left == versions[6]->left);
+    for (i = 1; i < n; i++)
+        pavl_release(versions[i]);
+    return (0);
+}
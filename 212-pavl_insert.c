@@ -0,0 +1,43 @@
+#include "binary_trees.h"
+/**
+* pavl_insert_node - copies the path of a persistent AVL subtree down to
+* the place of a new value
+* @node: pointer to the root node of the subtree
+* @value: value to insert
+* Return: reference to the root of the new subtree, or NULL on failure or
+* duplicate value
+*/
+pavl_t *pavl_insert_node(pavl_t *node, int value)
+{
+	pavl_t *child;
+
+	if (!node)
+		return (pavl_node(value, NULL, NULL));
+	if (value == node->n)
+		return (NULL);
+	if (value < node->n)
+	{
+		child = pavl_insert_node(node->left, value);
+		if (!child)
+			return (NULL);
+		return (pavl_make(node->n, child, pavl_retain(node->right)));
+	}
+	child = pavl_insert_node(node->right, value);
+	if (!child)
+		return (NULL);
+	return (pavl_make(node->n, pavl_retain(node->left), child));
+}
+/**
+* pavl_insert - creates a new persistent AVL version holding one more value
+* @root: pointer to the root node of the version to start from, unchanged
+* @value: value to insert
+* Return: reference to the root of the new version, or NULL on failure or
+* if value is already in the tree
+*
+* Description: only the O(log n) nodes of the path are copied, the other
+* subtrees are shared with root.
+*/
+pavl_t *pavl_insert(pavl_t *root, int value)
+{
+	return (pavl_insert_node(root, value));
+}
@@ -0,0 +1,56 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_version - Prints a persistent AVL version
+ *
+ * @root: Pointer to the root node of the version
+ */
+void print_version(const pavl_t *root)
+{
+    binary_tree_t *tree;
+
+    tree = pavl_to_tree(root);
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    pavl_t *root, *snapshot, *next;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    root = NULL;
+    for (i = 0; i < n; i++)
+    {
+        next = pavl_insert(root, array[i]);
+        pavl_release(root);
+        root = next;
+    }
+    snapshot = pavl_retain(root);
+    for (i = 0; i < 4; i++)
+    {
+        next = pavl_remove(root, array[i]);
+        pavl_release(root);
+        root = next;
+        printf("Removed %d\n", array[i]);
+    }
+    printf("Snapshot:\n");
+    print_version(snapshot);
+    printf("Current:\n");
+    print_version(root);
+    pavl_release(snapshot);
+    pavl_release(root);
+    return (0);
+}
@@ -0,0 +1,53 @@
+#include "binary_trees.h"
+/**
+* pavl_remove_node - copies the path of a persistent AVL subtree down to
+* a value it holds and leaves the value out
+* @node: pointer to the root node of the subtree, holding value
+* @value: value to remove
+* @failed: address set to 1 on failure
+* Return: reference to the root of the new subtree
+*/
+pavl_t *pavl_remove_node(pavl_t *node, int value, int *failed)
+{
+	pavl_t *child, *min;
+	pavl_t *new;
+
+	if (value == node->n && (!node->left || !node->right))
+		return (pavl_retain(node->left ? node->left : node->right));
+	if (value < node->n)
+	{
+		child = pavl_remove_node(node->left, value, failed);
+		if (*failed)
+			return (NULL);
+		new = pavl_make(node->n, child, pavl_retain(node->right));
+	}
+	else
+	{
+		for (min = node->right; value == node->n && min->left;)
+			min = min->left;
+		child = pavl_remove_node(node->right,
+			value == node->n ? min->n : value, failed);
+		if (*failed)
+			return (NULL);
+		new = pavl_make(value == node->n ? min->n : node->n,
+			pavl_retain(node->left), child);
+	}
+	*failed = !new;
+	return (new);
+}
+/**
+* pavl_remove - creates a new persistent AVL version without a value
+* @root: pointer to the root node of the version to start from, unchanged
+* @value: value to remove
+* Return: reference to the root of the new version (a new reference to root
+* if value is not in the tree), or NULL if the new version is empty or on
+* failure
+*/
+pavl_t *pavl_remove(pavl_t *root, int value)
+{
+	int failed = 0;
+
+	if (!pavl_search(root, value))
+		return (pavl_retain(root));
+	return (pavl_remove_node(root, value, &failed));
+}
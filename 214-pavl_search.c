@@ -0,0 +1,40 @@
+#include "binary_trees.h"
+/**
+* pavl_search - searches for a value in a persistent AVL version
+* @root: pointer to the root node of the version
+* @value: value to search in the tree
+* Return: pointer to the node containing value, or NULL if it is not found
+*/
+const pavl_t *pavl_search(const pavl_t *root, int value)
+{
+	while (root && root->n != value)
+		root = value < root->n ? root->left : root->right;
+	return (root);
+}
+/**
+* pavl_to_tree - copies a persistent AVL version into binary tree nodes
+* @root: pointer to the root node of the version
+* Return: pointer to the root node of the copy, or NULL on failure
+*/
+binary_tree_t *pavl_to_tree(const pavl_t *root)
+{
+	binary_tree_t *tree;
+
+	if (!root)
+		return (NULL);
+	tree = binary_tree_node(NULL, root->n);
+	if (!tree)
+		return (NULL);
+	tree->left = pavl_to_tree(root->left);
+	tree->right = pavl_to_tree(root->right);
+	if ((root->left && !tree->left) || (root->right && !tree->right))
+	{
+		binary_tree_delete(tree);
+		return (NULL);
+	}
+	if (tree->left)
+		tree->left->parent = tree;
+	if (tree->right)
+		tree->right->parent = tree;
+	return (tree);
+}
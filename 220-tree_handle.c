@@ -0,0 +1,76 @@
+#include "binary_trees.h"
+/**
+* tree_handle_create - creates a thread-safe handle on an AVL tree
+* @root: pointer to the root node of the tree, owned by the handle
+* Return: pointer to the new handle, or NULL on failure
+*/
+tree_handle_t *tree_handle_create(avl_t *root)
+{
+	void *mem;
+	tree_handle_t *handle;
+	int i;
+
+	if (posix_memalign(&mem, 64, sizeof(tree_handle_t)))
+		return (NULL);
+	handle = mem;
+	if (pthread_mutex_init(&handle->lock, NULL))
+	{
+		free(handle);
+		return (NULL);
+	}
+	handle->root = root;
+	handle->seq = 0;
+	for (i = 0; i < TREE_READERS; i++)
+		handle->slots[i].active = 0;
+	return (handle);
+}
+/**
+* tree_handle_delete - deletes a tree handle and its tree
+* @handle: pointer to the handle, with no thread left using it
+* Return: void
+*/
+void tree_handle_delete(tree_handle_t *handle)
+{
+	if (!handle)
+		return;
+	pthread_mutex_destroy(&handle->lock);
+	binary_tree_delete(handle->root);
+	free(handle);
+}
+/**
+* tree_handle_enter - starts a read of a tree handle
+* @handle: pointer to the handle
+* @reader: slot of the calling thread, below TREE_READERS
+* Return: void
+*
+* Description: the reader only stores to its own slot. It raises the slot,
+* then checks that no writer bumped the sequence meanwhile; a writer bumps
+* the sequence, then waits for the raised slots, so one of them always
+* sees the other.
+*/
+void tree_handle_enter(tree_handle_t *handle, int reader)
+{
+	tree_slot_t *slot = &handle->slots[reader];
+	unsigned int seq;
+
+	for (;;)
+	{
+		seq = __atomic_load_n(&handle->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1)
+			continue;
+		__atomic_store_n(&slot->active, 1, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&handle->seq, __ATOMIC_SEQ_CST) == seq)
+			return;
+		__atomic_store_n(&slot->active, 0, __ATOMIC_RELEASE);
+	}
+}
+/**
+* tree_handle_leave - ends a read of a tree handle
+* @handle: pointer to the handle
+* @reader: slot of the calling thread
+* Return: void
+*/
+void tree_handle_leave(tree_handle_t *handle, int reader)
+{
+	__atomic_store_n(&handle->slots[reader].active, 0, __ATOMIC_RELEASE);
+}
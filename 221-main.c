@@ -0,0 +1,44 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_num - Prints a number
+ *
+ * @n: Number to be printed
+ */
+void print_num(int n)
+{
+    printf("%d ", n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    tree_handle_t *handle;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i, found;
+
+    handle = tree_handle_create(NULL);
+    if (!handle)
+        return (1);
+    for (i = 0; i < n; i++)
+        tree_handle_insert(handle, array[i]);
+    printf("Insert 84 again: %d\n", tree_handle_insert(handle, 84));
+    printf("Search 62: %d\n", tree_handle_search(handle, 0, 62));
+    printf("Remove 62: %d\n", tree_handle_remove(handle, 62));
+    printf("Search 62: %d\n", tree_handle_search(handle, 0, 62));
+    found = tree_handle_range(handle, 1, 20, 90, print_num);
+    printf("\nFound: %lu\n", (unsigned long)found);
+    binary_tree_print(handle->root);
+    tree_handle_delete(handle);
+    return (0);
+}
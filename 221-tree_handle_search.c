@@ -0,0 +1,67 @@
+#include "binary_trees.h"
+/**
+* tree_handle_search - searches for a value through a tree handle
+* @handle: pointer to the handle
+* @reader: slot of the calling thread, below TREE_READERS
+* @value: value to search in the tree
+* Return: 1 if the value is in the tree, 0 otherwise
+*/
+int tree_handle_search(tree_handle_t *handle, int reader, int value)
+{
+	int found;
+
+	tree_handle_enter(handle, reader);
+	found = bst_search(handle->root, value) != NULL;
+	tree_handle_leave(handle, reader);
+	return (found);
+}
+/**
+* tree_range_walk - goes in order through the values of a subtree within
+* a range
+* @tree: pointer to the root node of the subtree
+* @lo: smallest value of the range
+* @hi: greatest value of the range
+* @func: pointer to a function to call for each value, or NULL
+* Return: number of values in the range
+*/
+size_t tree_range_walk(const binary_tree_t *tree, int lo, int hi,
+	void (*func)(int))
+{
+	size_t count = 0;
+
+	while (tree)
+	{
+		if (tree->n < lo)
+			tree = tree->right;
+		else if (tree->n > hi)
+			tree = tree->left;
+		else
+			break;
+	}
+	if (!tree)
+		return (0);
+	count = tree_range_walk(tree->left, lo, hi, func);
+	if (func)
+		func(tree->n);
+	return (count + 1 + tree_range_walk(tree->right, lo, hi, func));
+}
+/**
+* tree_handle_range - goes through the values of a tree handle within a
+* range, in order
+* @handle: pointer to the handle
+* @reader: slot of the calling thread, below TREE_READERS
+* @lo: smallest value of the range
+* @hi: greatest value of the range
+* @func: pointer to a function to call for each value, or NULL
+* Return: number of values in the range
+*/
+size_t tree_handle_range(tree_handle_t *handle, int reader, int lo, int hi,
+	void (*func)(int))
+{
+	size_t count;
+
+	tree_handle_enter(handle, reader);
+	count = tree_range_walk(handle->root, lo, hi, func);
+	tree_handle_leave(handle, reader);
+	return (count);
+}
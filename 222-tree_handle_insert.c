@@ -0,0 +1,63 @@
+#include "binary_trees.h"
+/**
+* tree_handle_lock - starts a write of a tree handle
+* @handle: pointer to the handle
+* Return: void
+*
+* Description: the AVL functions rotate and free nodes in place, so the
+* writer makes the sequence odd to hold off new readers and waits for the
+* reads already started to end.
+*/
+void tree_handle_lock(tree_handle_t *handle)
+{
+	tree_slot_t *slot;
+
+	pthread_mutex_lock(&handle->lock);
+	__atomic_store_n(&handle->seq, handle->seq + 1, __ATOMIC_SEQ_CST);
+	for (slot = handle->slots; slot < handle->slots + TREE_READERS; slot++)
+		while (__atomic_load_n(&slot->active, __ATOMIC_SEQ_CST))
+			;
+}
+/**
+* tree_handle_unlock - ends a write of a tree handle
+* @handle: pointer to the handle
+* Return: void
+*/
+void tree_handle_unlock(tree_handle_t *handle)
+{
+	__atomic_store_n(&handle->seq, handle->seq + 1, __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&handle->lock);
+}
+/**
+* tree_handle_insert - inserts a value through a tree handle
+* @handle: pointer to the handle
+* @value: value to insert
+* Return: 1 if the value was inserted, 0 if it was already there or on
+* failure
+*/
+int tree_handle_insert(tree_handle_t *handle, int value)
+{
+	int inserted;
+
+	tree_handle_lock(handle);
+	inserted = avl_insert(&handle->root, value) != NULL;
+	tree_handle_unlock(handle);
+	return (inserted);
+}
+/**
+* tree_handle_remove - removes a value through a tree handle
+* @handle: pointer to the handle
+* @value: value to remove
+* Return: 1 if the value was removed, 0 if it was not in the tree
+*/
+int tree_handle_remove(tree_handle_t *handle, int value)
+{
+	int found;
+
+	tree_handle_lock(handle);
+	found = bst_search(handle->root, value) != NULL;
+	if (found)
+		handle->root = avl_remove(handle->root, value);
+	tree_handle_unlock(handle);
+	return (found);
+}
@@ -0,0 +1,163 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * struct bench_s - Shared state of the benchmark threads
+ *
+ * @handle: Handle on the tree
+ * @keys: Number of keys in the tree
+ * @lookups: Number of lookups per reader
+ * @stop: Set to 1 to stop the writer
+ * @writes: Number of writes done by the writer
+ */
+typedef struct bench_s
+{
+    tree_handle_t *handle;
+    int keys;
+    size_t lookups;
+    int stop;
+    size_t writes;
+} bench_t;
+
+/**
+ * struct reader_s - Argument of a reader thread
+ *
+ * @bench: Shared state
+ * @slot: Reader slot of the thread
+ * @found: Number of keys found
+ */
+typedef struct reader_s
+{
+    bench_t *bench;
+    int slot;
+    size_t found;
+} reader_t;
+
+/**
+ * reader - Looks up random keys through the handle
+ *
+ * @arg: Pointer to the reader_t of the thread
+ *
+ * Return: NULL
+ */
+void *reader(void *arg)
+{
+    reader_t *r = arg;
+    unsigned int x = 2463534242u + r->slot;
+    size_t i;
+
+    for (i = 0; i < r->bench->lookups; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        r->found += tree_handle_search(r->bench->handle, r->slot,
+                                       (int)(x % (2u * r->bench->keys)));
+    }
+    return (NULL);
+}
+
+/**
+ * writer - Inserts and removes odd keys every 100 microseconds
+ *
+ * @arg: Pointer to the bench_t
+ *
+ * Return: NULL
+ */
+void *writer(void *arg)
+{
+    bench_t *b = arg;
+    struct timespec pause = {0, 100000};
+    int key;
+
+    while (!__atomic_load_n(&b->stop, __ATOMIC_ACQUIRE))
+    {
+        key = (int)(b->writes % b->keys) * 2 + 1;
+        if (b->writes % (2 * b->keys) < (size_t)b->keys)
+            tree_handle_insert(b->handle, key);
+        else
+            tree_handle_remove(b->handle, key);
+        b->writes++;
+        nanosleep(&pause, NULL);
+    }
+    return (NULL);
+}
+
+/**
+ * run - Runs one benchmark round and prints its CSV line
+ *
+ * @b: Shared state
+ * @readers: Number of reader threads
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int run(bench_t *b, int readers)
+{
+    pthread_t threads[TREE_READERS], write_thread;
+    reader_t args[TREE_READERS];
+    struct timespec start, end;
+    double ns;
+    int i;
+
+    b->stop = 0;
+    b->writes = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (pthread_create(&write_thread, NULL, writer, b))
+        return (1);
+    for (i = 0; i < readers; i++)
+    {
+        args[i].bench = b;
+        args[i].slot = i;
+        args[i].found = 0;
+        pthread_create(&threads[i], NULL, reader, &args[i]);
+    }
+    for (i = 0; i < readers; i++)
+        pthread_join(threads[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    __atomic_store_n(&b->stop, 1, __ATOMIC_RELEASE);
+    pthread_join(write_thread, NULL);
+    ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("%d,%lu,%lu,%.1f,%.2f\n", readers,
+           (unsigned long)(b->lookups * readers), (unsigned long)b->writes,
+           ns / b->lookups, b->lookups * readers * 1e3 / ns);
+    return (0);
+}
+
+/**
+ * main - Benchmarks readers against a trickle of writes on a tree handle
+ * @ac: argument count
+ * @av: av[1] is the optional number of keys, av[2] the optional number of
+ * lookups per reader
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    bench_t b;
+    int *keys;
+    int i, readers;
+
+    b.keys = 100000;
+    b.lookups = 200000;
+    if (ac > 1)
+        b.keys = atoi(av[1]);
+    if (ac > 2)
+        b.lookups = strtoul(av[2], NULL, 10);
+    keys = malloc(sizeof(*keys) * b.keys);
+    if (!keys || b.keys <= 0)
+        return (1);
+    for (i = 0; i < b.keys; i++)
+        keys[i] = i * 2;
+    b.handle = tree_handle_create(sorted_array_to_avl(keys, b.keys));
+    free(keys);
+    if (!b.handle)
+        return (1);
+    printf("readers,lookups,writes,ns_per_lookup,mlookups_per_s\n");
+    for (readers = 1; readers <= TREE_READERS; readers *= 2)
+        if (run(&b, readers))
+            return (1);
+    tree_handle_delete(b.handle);
+    return (0);
+}
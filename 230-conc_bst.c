@@ -0,0 +1,96 @@
+#include "binary_trees.h"
+/**
+* conc_node - creates a concurrent BST node
+* @value: value to put in the new node
+* @leaf: 1 to create a leaf, 0 to create an internal node
+* @inf: 0 for a real value, 1 or 2 for a sentinel key
+* Return: pointer to the new node, or NULL on failure
+*/
+conc_node_t *conc_node(int value, int leaf, int inf)
+{
+	conc_node_t *node;
+
+	node = malloc(sizeof(conc_node_t));
+	if (!node)
+		return (NULL);
+	node->n = value;
+	node->leaf = leaf;
+	node->inf = inf;
+	node->removed = 0;
+	node->lock = 0;
+	node->epoch = 0;
+	node->left = NULL;
+	node->right = NULL;
+	node->next = NULL;
+	return (node);
+}
+/**
+* conc_bst_create - creates an empty concurrent BST
+* Return: pointer to the new tree, or NULL on failure
+*
+* Description: the root has the key inf2, a leaf inf1 on its left and a
+* leaf inf2 on its right, so every real leaf has a parent and a grandparent.
+*/
+conc_bst_t *conc_bst_create(void)
+{
+	void *mem;
+	conc_bst_t *tree;
+	int i;
+
+	if (posix_memalign(&mem, 64, sizeof(conc_bst_t)))
+		return (NULL);
+	tree = mem;
+	tree->root = conc_node(0, 0, 2);
+	if (tree->root)
+	{
+		tree->root->left = conc_node(0, 1, 1);
+		tree->root->right = conc_node(0, 1, 2);
+	}
+	tree->epoch = 0;
+	for (i = 0; i < CONC_THREADS; i++)
+	{
+		tree->threads[i].state = 0;
+		tree->threads[i].count = 0;
+		tree->threads[i].retired = NULL;
+	}
+	if (!tree->root || !tree->root->left || !tree->root->right)
+	{
+		conc_bst_delete(tree);
+		return (NULL);
+	}
+	return (tree);
+}
+/**
+* conc_delete_nodes - deletes a subtree of a concurrent BST
+* @node: pointer to the root node of the subtree
+* Return: void
+*/
+void conc_delete_nodes(conc_node_t *node)
+{
+	if (!node)
+		return;
+	conc_delete_nodes(node->left);
+	conc_delete_nodes(node->right);
+	free(node);
+}
+/**
+* conc_bst_delete - deletes a concurrent BST and its retired nodes
+* @tree: pointer to the tree, with no thread left using it
+* Return: void
+*/
+void conc_bst_delete(conc_bst_t *tree)
+{
+	conc_node_t *node, *next;
+	int i;
+
+	if (!tree)
+		return;
+	conc_delete_nodes(tree->root);
+	for (i = 0; i < CONC_THREADS; i++)
+		for (node = tree->threads[i].retired; node; node = next)
+		{
+			next = node->next;
+			free(node);
+		}
+	free(tree);
+}
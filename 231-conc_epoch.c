@@ -0,0 +1,80 @@
+#include "binary_trees.h"
+/**
+* conc_enter - starts an operation of a thread on a concurrent BST
+* @tree: pointer to the tree
+* @thread: index of the calling thread, below CONC_THREADS
+* Return: void
+*
+* Description: the thread publishes the epoch it saw; the epoch cannot
+* move two steps past it until the thread leaves, so the nodes it may
+* still reach are not freed.
+*/
+void conc_enter(conc_bst_t *tree, int thread)
+{
+	unsigned int epoch = __atomic_load_n(&tree->epoch, __ATOMIC_ACQUIRE);
+
+	__atomic_store_n(&tree->threads[thread].state, (epoch << 1) | 1,
+		__ATOMIC_SEQ_CST);
+}
+/**
+* conc_leave - ends an operation of a thread on a concurrent BST
+* @tree: pointer to the tree
+* @thread: index of the calling thread
+* Return: void
+*/
+void conc_leave(conc_bst_t *tree, int thread)
+{
+	__atomic_store_n(&tree->threads[thread].state, 0, __ATOMIC_RELEASE);
+}
+/**
+* conc_collect - moves the epoch on if every thread inside the tree saw it,
+* then frees the retired nodes no thread can reach anymore
+* @tree: pointer to the tree
+* @self: state of the calling thread
+* Return: void
+*/
+void conc_collect(conc_bst_t *tree, conc_thread_t *self)
+{
+	unsigned int epoch, state;
+	conc_node_t **link, *node;
+	int i;
+
+	epoch = __atomic_load_n(&tree->epoch, __ATOMIC_SEQ_CST);
+	for (i = 0; i < CONC_THREADS; i++)
+	{
+		state = __atomic_load_n(&tree->threads[i].state,
+			__ATOMIC_SEQ_CST);
+		if ((state & 1) && state != ((epoch << 1) | 1))
+			break;
+	}
+	if (i == CONC_THREADS)
+		__atomic_compare_exchange_n(&tree->epoch, &epoch, epoch + 1, 0,
+			__ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	epoch = __atomic_load_n(&tree->epoch, __ATOMIC_ACQUIRE);
+	for (link = &self->retired; *link && epoch - (*link)->epoch < 2;)
+		link = &(*link)->next;
+	while (*link)
+	{
+		node = *link;
+		*link = node->next;
+		self->count--;
+		free(node);
+	}
+}
+/**
+* conc_retire - hands an unlinked node over to epoch-based reclamation
+* @tree: pointer to the tree
+* @thread: index of the calling thread, inside the tree
+* @node: pointer to the unlinked node
+* Return: void
+*/
+void conc_retire(conc_bst_t *tree, int thread, conc_node_t *node)
+{
+	conc_thread_t *self = &tree->threads[thread];
+
+	node->epoch = __atomic_load_n(&tree->epoch, __ATOMIC_ACQUIRE);
+	node->next = self->retired;
+	self->retired = node;
+	if (++self->count % 32 == 0)
+		conc_collect(tree, self);
+}
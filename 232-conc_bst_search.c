@@ -0,0 +1,52 @@
+#include "binary_trees.h"
+/**
+* conc_child - reads the child of an internal node a value leads to
+* @node: pointer to the internal node
+* @value: value to look for
+* Return: pointer to the child node
+*/
+conc_node_t *conc_child(conc_node_t *node, int value)
+{
+	if (node->inf || value < node->n)
+		return (__atomic_load_n(&node->left, __ATOMIC_ACQUIRE));
+	return (__atomic_load_n(&node->right, __ATOMIC_ACQUIRE));
+}
+/**
+* conc_bst_find - goes down a concurrent BST to the leaf a value leads to
+* @tree: pointer to the tree
+* @value: value to look for
+* @path: filled with the grandparent, the parent and the leaf
+* Return: void
+*/
+void conc_bst_find(conc_bst_t *tree, int value, conc_node_t **path)
+{
+	conc_node_t *node = tree->root;
+
+	path[0] = NULL;
+	path[1] = NULL;
+	while (!node->leaf)
+	{
+		path[0] = path[1];
+		path[1] = node;
+		node = conc_child(node, value);
+	}
+	path[2] = node;
+}
+/**
+* conc_bst_search - searches for a value in a concurrent BST, without locks
+* @tree: pointer to the tree
+* @thread: index of the calling thread, below CONC_THREADS
+* @value: value to search in the tree
+* Return: 1 if the value is in the tree, 0 otherwise
+*/
+int conc_bst_search(conc_bst_t *tree, int thread, int value)
+{
+	conc_node_t *path[3];
+	int found;
+
+	conc_enter(tree, thread);
+	conc_bst_find(tree, value, path);
+	found = !path[2]->inf && path[2]->n == value;
+	conc_leave(tree, thread);
+	return (found);
+}
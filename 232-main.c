@@ -0,0 +1,67 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * struct worker_s - Argument of a worker thread
+ *
+ * @tree: Shared tree
+ * @thread: Index of the thread
+ */
+typedef struct worker_s
+{
+    conc_bst_t *tree;
+    int thread;
+} worker_t;
+
+/**
+ * insert_range - Inserts every value congruent to the thread index mod 4
+ *
+ * @arg: Pointer to the worker_t of the thread
+ *
+ * Return: NULL
+ */
+void *insert_range(void *arg)
+{
+    worker_t *w = arg;
+    int i;
+
+    for (i = w->thread; i < 100; i += 4)
+        conc_bst_insert(w->tree, w->thread, i);
+    return (NULL);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    conc_bst_t *tree;
+    pthread_t threads[4];
+    worker_t args[4];
+    int i, count = 0;
+
+    tree = conc_bst_create();
+    if (!tree)
+        return (1);
+    for (i = 0; i < 4; i++)
+    {
+        args[i].tree = tree;
+        args[i].thread = i;
+        pthread_create(&threads[i], NULL, insert_range, &args[i]);
+    }
+    for (i = 0; i < 4; i++)
+        pthread_join(threads[i], NULL);
+    for (i = 0; i < 100; i++)
+        count += conc_bst_search(tree, 0, i);
+    printf("Found %d values\n", count);
+    printf("Insert 42 again: %d\n", conc_bst_insert(tree, 0, 42));
+    printf("Remove 42: %d\n", conc_bst_remove(tree, 0, 42));
+    printf("Remove 42 again: %d\n", conc_bst_remove(tree, 0, 42));
+    printf("Search 42: %d\n", conc_bst_search(tree, 0, 42));
+    printf("Search 43: %d\n", conc_bst_search(tree, 0, 43));
+    conc_bst_delete(tree);
+    return (0);
+}
@@ -0,0 +1,94 @@
+#include "binary_trees.h"
+/**
+* conc_lock - takes the spin lock of a concurrent BST node
+* @node: pointer to the node
+* @try: 1 to give up at once if the lock is taken
+* Return: 1 if the lock was taken, 0 otherwise
+*
+* Description: the lock is held for a few stores only, so a waiter just
+* yields its time slice to a holder that may have been preempted.
+*/
+int conc_lock(conc_node_t *node, int try)
+{
+	while (__atomic_exchange_n(&node->lock, 1, __ATOMIC_ACQUIRE))
+	{
+		if (try)
+			return (0);
+		sched_yield();
+	}
+	return (1);
+}
+/**
+* conc_unlock - releases the spin lock of a concurrent BST node
+* @node: pointer to the node
+* Return: void
+*/
+void conc_unlock(conc_node_t *node)
+{
+	__atomic_store_n(&node->lock, 0, __ATOMIC_RELEASE);
+}
+/**
+* conc_link - replaces a child of a locked node if it is still in the tree
+* @node: pointer to the locked node
+* @old: pointer to the child expected
+* @new: pointer to the child to put in its place
+* Return: 1 if the child was replaced, 0 if the tree changed meanwhile
+*/
+int conc_link(conc_node_t *node, conc_node_t *old, conc_node_t *new)
+{
+	if (node->removed)
+		return (0);
+	if (node->left == old)
+		__atomic_store_n(&node->left, new, __ATOMIC_RELEASE);
+	else if (node->right == old)
+		__atomic_store_n(&node->right, new, __ATOMIC_RELEASE);
+	else
+		return (0);
+	return (1);
+}
+/**
+* conc_bst_insert - inserts a value in a concurrent BST
+* @tree: pointer to the tree
+* @thread: index of the calling thread, below CONC_THREADS
+* @value: value to insert
+* Return: 1 if the value was inserted, 0 if it was already there or on
+* failure
+*
+* Description: the leaf the value leads to is replaced by a new internal
+* node over the old leaf and the new one, under the lock of the parent.
+*/
+int conc_bst_insert(conc_bst_t *tree, int thread, int value)
+{
+	conc_node_t *path[3], *leaf, *node;
+	int done = 0;
+
+	leaf = conc_node(value, 1, 0);
+	node = conc_node(value, 0, 0);
+	conc_enter(tree, thread);
+	while (leaf && node && !done)
+	{
+		conc_bst_find(tree, value, path);
+		if (!path[2]->inf && path[2]->n == value)
+			break;
+		node->inf = path[2]->inf;
+		node->n = value;
+		node->left = path[2];
+		node->right = leaf;
+		if (path[2]->inf || value < path[2]->n)
+		{
+			node->n = path[2]->n;
+			node->left = leaf;
+			node->right = path[2];
+		}
+		conc_lock(path[1], 0);
+		done = conc_link(path[1], path[2], node);
+		conc_unlock(path[1]);
+	}
+	conc_leave(tree, thread);
+	if (!done)
+	{
+		free(leaf);
+		free(node);
+	}
+	return (done);
+}
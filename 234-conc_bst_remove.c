@@ -0,0 +1,61 @@
+#include "binary_trees.h"
+/**
+* conc_unlink - unlinks a leaf and its parent under their two locks
+* @path: grandparent, parent and leaf, as found by conc_bst_find
+* Return: 1 if they were unlinked, 0 if the tree changed meanwhile
+*/
+int conc_unlink(conc_node_t **path)
+{
+	conc_node_t *parent = path[1], *sibling;
+	int done = 0;
+
+	conc_lock(path[0], 0);
+	if (!conc_lock(parent, 1))
+	{
+		conc_unlock(path[0]);
+		return (0);
+	}
+	sibling = parent->left == path[2] ? parent->right : parent->left;
+	if (!parent->removed &&
+		(parent->left == path[2] || parent->right == path[2]))
+	{
+		done = conc_link(path[0], parent, sibling);
+		if (done)
+			parent->removed = 1;
+	}
+	conc_unlock(parent);
+	conc_unlock(path[0]);
+	return (done);
+}
+/**
+* conc_bst_remove - removes a value from a concurrent BST
+* @tree: pointer to the tree
+* @thread: index of the calling thread, below CONC_THREADS
+* @value: value to remove
+* Return: 1 if the value was removed, 0 if it was not in the tree
+*
+* Description: the leaf and its parent are replaced by the leaf's sibling,
+* under the locks of the grandparent and the parent, then retired.
+*/
+int conc_bst_remove(conc_bst_t *tree, int thread, int value)
+{
+	conc_node_t *path[3];
+	int done = 0;
+
+	conc_enter(tree, thread);
+	for (;;)
+	{
+		conc_bst_find(tree, value, path);
+		if (path[2]->inf || path[2]->n != value)
+			break;
+		done = conc_unlink(path);
+		if (done)
+		{
+			conc_retire(tree, thread, path[1]);
+			conc_retire(tree, thread, path[2]);
+			break;
+		}
+	}
+	conc_leave(tree, thread);
+	return (done);
+}
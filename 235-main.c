@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * struct bench_s - Shared state of the benchmark threads
+ *
+ * @conc: Concurrent tree
+ * @bst: Plain BST shared under @lock
+ * @locked: 1 to run on @bst, 0 to run on @conc
+ * @lock: Global mutex of the baseline
+ * @keys: Range of the keys
+ * @ops: Number of operations per thread
+ */
+typedef struct bench_s
+{
+    conc_bst_t *conc;
+    bst_t *bst;
+    int locked;
+    pthread_mutex_t lock;
+    int keys;
+    size_t ops;
+} bench_t;
+
+/**
+ * struct worker_s - Argument of a worker thread
+ *
+ * @bench: Shared state
+ * @thread: Index of the thread
+ */
+typedef struct worker_s
+{
+    bench_t *bench;
+    int thread;
+} worker_t;
+
+/**
+ * locked_op - Runs one operation on the baseline BST under the global lock
+ *
+ * @b: Shared state
+ * @op: 0 to search, 1 to insert, 2 to remove
+ * @key: Key of the operation
+ */
+void locked_op(bench_t *b, int op, int key)
+{
+    pthread_mutex_lock(&b->lock);
+    if (op == 0)
+        bst_search(b->bst, key);
+    else if (op == 1)
+        bst_insert(&b->bst, key);
+    else if (bst_search(b->bst, key))
+        b->bst = bst_remove(b->bst, key);
+    pthread_mutex_unlock(&b->lock);
+}
+
+/**
+ * worker - Runs a 50/50 read/write mix of random keys
+ *
+ * @arg: Pointer to the worker_t of the thread
+ *
+ * Return: NULL
+ */
+void *worker(void *arg)
+{
+    worker_t *w = arg;
+    bench_t *b = w->bench;
+    unsigned int x = 2463534242u + w->thread * 7919;
+    size_t i;
+    int key, op;
+
+    for (i = 0; i < b->ops; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        key = (int)(x % (unsigned int)b->keys);
+        op = x >> 30 < 2 ? 0 : (int)(x >> 30) - 1;
+        if (b->locked)
+            locked_op(b, op, key);
+        else if (op == 0)
+            conc_bst_search(b->conc, w->thread, key);
+        else if (op == 1)
+            conc_bst_insert(b->conc, w->thread, key);
+        else
+            conc_bst_remove(b->conc, w->thread, key);
+    }
+    return (NULL);
+}
+
+/**
+ * run - Runs one benchmark round and prints its CSV line
+ *
+ * @b: Shared state
+ * @name: Name of the tree
+ * @threads: Number of threads
+ */
+void run(bench_t *b, const char *name, int threads)
+{
+    pthread_t ids[CONC_THREADS];
+    worker_t args[CONC_THREADS];
+    struct timespec start, end;
+    double ns;
+    int i;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < threads; i++)
+    {
+        args[i].bench = b;
+        args[i].thread = i;
+        pthread_create(&ids[i], NULL, worker, &args[i]);
+    }
+    for (i = 0; i < threads; i++)
+        pthread_join(ids[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("%s,%d,%lu,%.2f\n", name, threads,
+           (unsigned long)(b->ops * threads), b->ops * threads * 1e3 / ns);
+}
+
+/**
+ * main - Benchmarks the concurrent BST against a BST under a global lock
+ * @ac: argument count
+ * @av: av[1] is the optional range of the keys, av[2] the optional number
+ * of operations per thread, av[3] the optional largest thread count
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    bench_t b;
+    int threads, max = 16;
+
+    b.keys = 100000;
+    b.ops = 200000;
+    if (ac > 1)
+        b.keys = atoi(av[1]);
+    if (ac > 2)
+        b.ops = strtoul(av[2], NULL, 10);
+    if (ac > 3)
+        max = atoi(av[3]);
+    if (b.keys <= 0 || max < 1 || max > CONC_THREADS)
+        return (1);
+    b.bst = NULL;
+    b.conc = conc_bst_create();
+    if (!b.conc || pthread_mutex_init(&b.lock, NULL))
+        return (1);
+    printf("tree,threads,ops,mops_per_s\n");
+    for (threads = 1; threads <= max; threads *= 2)
+    {
+        b.locked = 0;
+        run(&b, "conc_bst", threads);
+        b.locked = 1;
+        run(&b, "locked_bst", threads);
+    }
+    conc_bst_delete(b.conc);
+    binary_tree_delete(b.bst);
+    pthread_mutex_destroy(&b.lock);
+    return (0);
+}
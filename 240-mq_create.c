@@ -0,0 +1,67 @@
+#include "binary_trees.h"
+/**
+* mq_create - creates an empty MultiQueue
+* @count: number of sub-queues, twice the number of threads is a good start
+* Return: pointer to the new queue, or NULL on failure
+*/
+mq_t *mq_create(size_t count)
+{
+	mq_t *mq;
+	void *mem;
+	size_t i;
+
+	if (!count)
+		return (NULL);
+	mq = malloc(sizeof(mq_t));
+	if (!mq)
+		return (NULL);
+	if (posix_memalign(&mem, 64, sizeof(mq_queue_t) * count))
+	{
+		free(mq);
+		return (NULL);
+	}
+	mq->queues = mem;
+	mq->count = count;
+	for (i = 0; i < count; i++)
+	{
+		mq->queues[i].heap.keys = NULL;
+		mq->queues[i].heap.size = 0;
+		mq->queues[i].heap.capacity = 0;
+		mq->queues[i].lock = 0;
+		mq->queues[i].top = 0;
+		mq->queues[i].filled = 0;
+	}
+	return (mq);
+}
+/**
+* mq_delete - deletes a MultiQueue
+* @mq: pointer to the queue, with no thread left using it
+* Return: void
+*/
+void mq_delete(mq_t *mq)
+{
+	size_t i;
+
+	if (!mq)
+		return;
+	for (i = 0; i < mq->count; i++)
+		free(mq->queues[i].heap.keys);
+	free(mq->queues);
+	free(mq);
+}
+/**
+* mq_random - draws a random sub-queue of a MultiQueue
+* @mq: pointer to the queue
+* @seed: xorshift state owned by the calling thread
+* Return: pointer to the sub-queue
+*/
+mq_queue_t *mq_random(mq_t *mq, unsigned int *seed)
+{
+	unsigned int x = *seed ? *seed : 2463534242u;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*seed = x;
+	return (mq->queues + (x * 2654435761u >> 8) % mq->count);
+}
@@ -0,0 +1,52 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * drain - Extracts and prints every value of a MultiQueue
+ *
+ * @mq: Pointer to the queue
+ * @seed: Pointer to the xorshift state of the thread
+ */
+void drain(mq_t *mq, unsigned int *seed)
+{
+    int value;
+
+    while (mq_extract(mq, seed, &value))
+        printf("%d ", value);
+    printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    mq_t *exact, *relaxed;
+    unsigned int seed = 0;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    size_t i;
+
+    exact = mq_create(1);
+    relaxed = mq_create(4);
+    if (!exact || !relaxed)
+        return (1);
+    for (i = 0; i < n; i++)
+    {
+        mq_insert(exact, &seed, array[i]);
+        mq_insert(relaxed, &seed, array[i]);
+    }
+    printf("One sub-queue:\n");
+    drain(exact, &seed);
+    printf("Four sub-queues:\n");
+    drain(relaxed, &seed);
+    mq_delete(exact);
+    mq_delete(relaxed);
+    return (0);
+}
@@ -0,0 +1,50 @@
+#include "binary_trees.h"
+/**
+* mq_trylock - takes the lock of a MultiQueue sub-queue if it is free
+* @queue: pointer to the sub-queue
+* Return: 1 if the lock was taken, 0 otherwise
+*/
+int mq_trylock(mq_queue_t *queue)
+{
+	if (__atomic_load_n(&queue->lock, __ATOMIC_RELAXED))
+		return (0);
+	return (!__atomic_exchange_n(&queue->lock, 1, __ATOMIC_ACQUIRE));
+}
+/**
+* mq_unlock - publishes the top of a MultiQueue sub-queue and releases it
+* @queue: pointer to the locked sub-queue
+* Return: void
+*/
+void mq_unlock(mq_queue_t *queue)
+{
+	if (queue->heap.size)
+		__atomic_store_n(&queue->top, queue->heap.keys[0],
+			__ATOMIC_RELAXED);
+	__atomic_store_n(&queue->filled, queue->heap.size != 0,
+		__ATOMIC_RELAXED);
+	__atomic_store_n(&queue->lock, 0, __ATOMIC_RELEASE);
+}
+/**
+* mq_insert - inserts a value in a MultiQueue
+* @mq: pointer to the queue
+* @seed: xorshift state owned by the calling thread
+* @value: value to insert
+* Return: 1 on success, 0 on failure
+*
+* Description: the value goes to a random sub-queue; a busy sub-queue is
+* skipped for another one rather than waited for.
+*/
+int mq_insert(mq_t *mq, unsigned int *seed, int value)
+{
+	mq_queue_t *queue;
+	int done;
+
+	if (!mq || !seed)
+		return (0);
+	do {
+		queue = mq_random(mq, seed);
+	} while (!mq_trylock(queue));
+	done = cheap_insert(&queue->heap, value) != NULL;
+	mq_unlock(queue);
+	return (done);
+}
@@ -0,0 +1,73 @@
+#include "binary_trees.h"
+/**
+* mq_pick - picks the sub-queue with the greater top out of two random ones
+* @mq: pointer to the queue
+* @seed: xorshift state owned by the calling thread
+* Return: pointer to the sub-queue, or NULL if both looked empty
+*/
+mq_queue_t *mq_pick(mq_t *mq, unsigned int *seed)
+{
+	mq_queue_t *a = mq_random(mq, seed), *b = mq_random(mq, seed);
+	int full_a = __atomic_load_n(&a->filled, __ATOMIC_RELAXED);
+	int full_b = __atomic_load_n(&b->filled, __ATOMIC_RELAXED);
+
+	if (full_a && full_b)
+		return (__atomic_load_n(&a->top, __ATOMIC_RELAXED) >=
+			__atomic_load_n(&b->top, __ATOMIC_RELAXED) ? a : b);
+	if (full_a)
+		return (a);
+	return (full_b ? b : NULL);
+}
+/**
+* mq_scan - looks for a sub-queue holding a value, starting at a random one
+* @mq: pointer to the queue
+* @seed: xorshift state owned by the calling thread
+* Return: pointer to the sub-queue, or NULL if they all looked empty
+*/
+mq_queue_t *mq_scan(mq_t *mq, unsigned int *seed)
+{
+	mq_queue_t *start = mq_random(mq, seed), *queue = start;
+
+	do {
+		if (__atomic_load_n(&queue->filled, __ATOMIC_RELAXED))
+			return (queue);
+		if (++queue == mq->queues + mq->count)
+			queue = mq->queues;
+	} while (queue != start);
+	return (NULL);
+}
+/**
+* mq_extract - extracts one of the greatest values of a MultiQueue
+* @mq: pointer to the queue
+* @seed: xorshift state owned by the calling thread
+* @value: address where to store the value extracted
+* Return: 1 if a value was extracted, 0 if the queue looked empty
+*
+* Description: the greater top of two random sub-queues is taken, so the
+* value is among the O(count) greatest ones rather than the very greatest.
+* An empty result is only reported after a scan of every sub-queue.
+*/
+int mq_extract(mq_t *mq, unsigned int *seed, int *value)
+{
+	mq_queue_t *queue;
+
+	if (!mq || !seed || !value)
+		return (0);
+	for (;;)
+	{
+		queue = mq_pick(mq, seed);
+		if (!queue)
+			queue = mq_scan(mq, seed);
+		if (!queue)
+			return (0);
+		if (!mq_trylock(queue))
+			continue;
+		if (queue->heap.size)
+		{
+			*value = cheap_extract(&queue->heap);
+			mq_unlock(queue);
+			return (1);
+		}
+		mq_unlock(queue);
+	}
+}
@@ -0,0 +1,144 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * struct bench_s - Shared state of the benchmark threads
+ *
+ * @mq: MultiQueue
+ * @heap: Max Binary Heap shared under @lock
+ * @locked: 1 to run on @heap, 0 to run on @mq
+ * @lock: Global mutex of the baseline
+ * @ops: Number of insert/extract pairs per thread
+ */
+typedef struct bench_s
+{
+    mq_t *mq;
+    heap_t *heap;
+    int locked;
+    pthread_mutex_t lock;
+    size_t ops;
+} bench_t;
+
+/**
+ * struct worker_s - Argument of a worker thread
+ *
+ * @bench: Shared state
+ * @seed: Xorshift state of the thread
+ */
+typedef struct worker_s
+{
+    bench_t *bench;
+    unsigned int seed;
+} worker_t;
+
+/**
+ * worker - Inserts a random job priority, then extracts the greatest one
+ *
+ * @arg: Pointer to the worker_t of the thread
+ *
+ * Return: NULL
+ */
+void *worker(void *arg)
+{
+    worker_t *w = arg;
+    bench_t *b = w->bench;
+    size_t i;
+    int value;
+
+    for (i = 0; i < b->ops; i++)
+    {
+        value = (int)(w->seed % 1000000);
+        w->seed = w->seed * 1103515245u + 12345u;
+        if (!b->locked)
+        {
+            mq_insert(b->mq, &w->seed, value);
+            mq_extract(b->mq, &w->seed, &value);
+            continue;
+        }
+        pthread_mutex_lock(&b->lock);
+        heap_insert(&b->heap, value);
+        heap_extract(&b->heap);
+        pthread_mutex_unlock(&b->lock);
+    }
+    return (NULL);
+}
+
+/**
+ * run - Runs one benchmark round and prints its CSV line
+ *
+ * @b: Shared state
+ * @name: Name of the queue
+ * @threads: Number of threads
+ */
+void run(bench_t *b, const char *name, int threads)
+{
+    pthread_t ids[64];
+    worker_t args[64];
+    struct timespec start, end;
+    double ns;
+    int i;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < threads; i++)
+    {
+        args[i].bench = b;
+        args[i].seed = i + 1;
+        pthread_create(&ids[i], NULL, worker, &args[i]);
+    }
+    for (i = 0; i < threads; i++)
+        pthread_join(ids[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("%s,%d,%lu,%.2f\n", name, threads,
+           (unsigned long)(b->ops * threads), b->ops * threads * 1e3 / ns);
+}
+
+/**
+ * main - Benchmarks the MultiQueue against a heap under a global lock
+ * @ac: argument count
+ * @av: av[1] is the optional number of jobs queued before the run, av[2]
+ * the optional number of insert/extract pairs per thread, av[3] the
+ * optional largest thread count
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    bench_t b;
+    unsigned int seed = 1;
+    size_t i, backlog = 10000;
+    int threads, max = 16;
+
+    b.ops = 20000;
+    if (ac > 1)
+        backlog = strtoul(av[1], NULL, 10);
+    if (ac > 2)
+        b.ops = strtoul(av[2], NULL, 10);
+    if (ac > 3)
+        max = atoi(av[3]);
+    if (max < 1 || max > 64)
+        return (1);
+    b.mq = mq_create(2 * max);
+    b.heap = NULL;
+    if (!b.mq || pthread_mutex_init(&b.lock, NULL))
+        return (1);
+    for (i = 0; i < backlog; i++)
+    {
+        mq_insert(b.mq, &seed, (int)(i * 7919 % 1000000));
+        heap_insert(&b.heap, (int)(i * 7919 % 1000000));
+    }
+    printf("queue,threads,pairs,mpairs_per_s\n");
+    for (threads = 1; threads <= max; threads *= 2)
+    {
+        b.locked = 0;
+        run(&b, "multiqueue", threads);
+        b.locked = 1;
+        run(&b, "locked_heap", threads);
+    }
+    mq_delete(b.mq);
+    binary_tree_delete(b.heap);
+    pthread_mutex_destroy(&b.lock);
+    return (0);
+}
@@ -0,0 +1,76 @@
+#include "binary_trees.h"
+/**
+* tree_deque_push - pushes a task at the tail of a worker deque
+* @deque: pointer to the deque
+* @node: pointer to the root node of the subtree
+* @depth: depth of node in the whole tree
+* Return: 1 on success, 0 on failure
+*/
+int tree_deque_push(tree_deque_t *deque, const binary_tree_t *node,
+	size_t depth)
+{
+	tree_task_t *tasks;
+	size_t capacity;
+	int done = 1;
+
+	pthread_mutex_lock(&deque->lock);
+	if (deque->tail == deque->capacity)
+	{
+		capacity = deque->capacity ? deque->capacity * 2 : 64;
+		tasks = realloc(deque->tasks, sizeof(tree_task_t) * capacity);
+		if (tasks)
+		{
+			deque->tasks = tasks;
+			deque->capacity = capacity;
+		}
+		done = tasks != NULL;
+	}
+	if (done)
+	{
+		deque->tasks[deque->tail].node = node;
+		deque->tasks[deque->tail++].depth = depth;
+	}
+	pthread_mutex_unlock(&deque->lock);
+	return (done);
+}
+/**
+* tree_deque_pop - pops the newest task of a worker deque
+* @deque: pointer to the deque
+* @task: address where to store the task
+* Return: 1 if a task was popped, 0 if the deque is empty
+*/
+int tree_deque_pop(tree_deque_t *deque, tree_task_t *task)
+{
+	int done;
+
+	pthread_mutex_lock(&deque->lock);
+	done = deque->head < deque->tail;
+	if (done)
+		*task = deque->tasks[--deque->tail];
+	if (deque->head == deque->tail)
+		deque->head = deque->tail = 0;
+	pthread_mutex_unlock(&deque->lock);
+	return (done);
+}
+/**
+* tree_deque_steal - steals the oldest task of a worker deque
+* @deque: pointer to the deque
+* @task: address where to store the task
+* Return: 1 if a task was stolen, 0 if the deque is empty
+*
+* Description: the oldest tasks are the highest subtrees, so a thief
+* takes the largest piece of work available.
+*/
+int tree_deque_steal(tree_deque_t *deque, tree_task_t *task)
+{
+	int done;
+
+	pthread_mutex_lock(&deque->lock);
+	done = deque->head < deque->tail;
+	if (done)
+		*task = deque->tasks[deque->head++];
+	if (deque->head == deque->tail)
+		deque->head = deque->tail = 0;
+	pthread_mutex_unlock(&deque->lock);
+	return (done);
+}
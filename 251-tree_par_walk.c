@@ -0,0 +1,64 @@
+#include "binary_trees.h"
+#include <unistd.h>
+/**
+* tree_par_threads - sets the number of threads of the parallel reductions
+* @threads: number of threads, or 0 to keep the current one
+* Return: number of threads in use, the online processors by default
+*/
+size_t tree_par_threads(size_t threads)
+{
+	static size_t count;
+	long online;
+
+	if (threads)
+		count = threads;
+	if (!count)
+	{
+		online = sysconf(_SC_NPROCESSORS_ONLN);
+		count = online > 0 ? (size_t)online : 1;
+	}
+	return (count);
+}
+/**
+* tree_par_walk - reduces a subtree sequentially, in preorder
+* @par: pointer to the reduction
+* @top: pointer to the root node of the subtree
+* @depth: depth of top in the whole tree
+* Return: combination of the values mapped from the subtree
+*
+* Description: the pending children are kept on a stack of TREE_WALK_STACK
+* entries, and a child found with that stack full is reduced by a nested
+* call, so the walk reads only the child pointers.
+*/
+size_t tree_par_walk(const tree_par_t *par, const binary_tree_t *top,
+	size_t depth)
+{
+	tree_task_t stack[TREE_WALK_STACK];
+	const binary_tree_t *node, *child;
+	size_t size = 1, result = par->identity;
+	int i;
+
+	stack[0].node = top;
+	stack[0].depth = depth;
+	while (size)
+	{
+		node = stack[--size].node;
+		depth = stack[size].depth;
+		result = par->combine(result, par->map(node, depth));
+		for (i = 0; i < 2; i++)
+		{
+			child = i ? node->left : node->right;
+			if (!child)
+				continue;
+			if (size == TREE_WALK_STACK)
+			{
+				result = par->combine(result,
+					tree_par_walk(par, child, depth + 1));
+				continue;
+			}
+			stack[size].node = child;
+			stack[size++].depth = depth + 1;
+		}
+	}
+	return (result);
+}
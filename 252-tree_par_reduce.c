@@ -0,0 +1,158 @@
+#include "binary_trees.h"
+/**
+* tree_par_run - runs a task: splits it above the cutoff, walks it below
+* @self: pointer to the worker running the task
+* @task: pointer to the task
+* Return: void
+*/
+void tree_par_run(tree_worker_t *self, const tree_task_t *task)
+{
+	tree_par_t *par = self->par;
+	const binary_tree_t *node = task->node, *child;
+	int i;
+
+	if (task->depth >= par->cutoff)
+	{
+		self->result = par->combine(self->result,
+			tree_par_walk(par, node, task->depth));
+		return;
+	}
+	self->result = par->combine(self->result, par->map(node, task->depth));
+	for (i = 0; i < 2; i++)
+	{
+		child = i ? node->right : node->left;
+		if (!child)
+			continue;
+		__atomic_add_fetch(&par->pending, 1, __ATOMIC_ACQ_REL);
+		if (tree_deque_push(&self->deque, child, task->depth + 1))
+			continue;
+		self->result = par->combine(self->result,
+			tree_par_walk(par, child, task->depth + 1));
+		__atomic_sub_fetch(&par->pending, 1, __ATOMIC_ACQ_REL);
+	}
+}
+/**
+* tree_par_steal - steals a task from another worker, drawn at random
+* @self: pointer to the thief
+* @task: address where to store the task
+* Return: 1 if a task was stolen, 0 if every other deque was empty
+*/
+int tree_par_steal(tree_worker_t *self, tree_task_t *task)
+{
+	tree_par_t *par = self->par;
+	tree_worker_t *victim;
+	size_t i;
+	unsigned int x = self->seed;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	self->seed = x;
+	victim = par->workers + x % par->count;
+	for (i = 0; i < par->count; i++)
+	{
+		if (victim != self && tree_deque_steal(&victim->deque, task))
+			return (1);
+		if (++victim == par->workers + par->count)
+			victim = par->workers;
+	}
+	return (0);
+}
+/**
+* tree_par_worker - runs tasks until every task of the reduction is done
+* @arg: pointer to the worker
+* Return: NULL
+*/
+void *tree_par_worker(void *arg)
+{
+	tree_worker_t *self = arg;
+	tree_task_t task;
+
+	while (__atomic_load_n(&self->par->pending, __ATOMIC_ACQUIRE))
+	{
+		if (!tree_deque_pop(&self->deque, &task) &&
+			!tree_par_steal(self, &task))
+		{
+			sched_yield();
+			continue;
+		}
+		tree_par_run(self, &task);
+		__atomic_sub_fetch(&self->par->pending, 1, __ATOMIC_ACQ_REL);
+	}
+	return (NULL);
+}
+/**
+* tree_par_join - waits for the workers, then combines their results
+* @par: pointer to the reduction
+* @started: number of workers whose thread was started, worker 0 apart
+* Return: combination of the results of the workers
+*/
+size_t tree_par_join(tree_par_t *par, size_t started)
+{
+	size_t i, result = par->identity;
+
+	for (i = 1; i <= started; i++)
+		pthread_join(par->workers[i].thread, NULL);
+	for (i = 0; i < par->count; i++)
+	{
+		result = par->combine(result, par->workers[i].result);
+		pthread_mutex_destroy(&par->workers[i].deque.lock);
+		free(par->workers[i].deque.tasks);
+	}
+	free(par->workers);
+	return (result);
+}
+/**
+* tree_par_reduce - maps every node of a binary tree and combines the
+* values, on a pool of work-stealing threads
+* @tree: pointer to the root node of the tree
+* @map: function mapping a node and its depth to a value
+* @combine: associative and commutative function combining two values
+* @identity: value neutral for combine
+* Return: combination of the values mapped from every node, identity if
+* tree is NULL
+*
+* Description: the subtrees above the cutoff depth become tasks, about
+* 64 per thread on a balanced tree; the calling thread is worker 0.
+*/
+size_t tree_par_reduce(const binary_tree_t *tree,
+	size_t (*map)(const binary_tree_t *, size_t),
+	size_t (*combine)(size_t, size_t), size_t identity)
+{
+	tree_par_t par;
+	size_t i;
+
+	if (!tree || !map || !combine)
+		return (identity);
+	par.map = map;
+	par.combine = combine;
+	par.identity = identity;
+	par.count = tree_par_threads(0);
+	for (par.cutoff = 6; (size_t)1 << (par.cutoff - 6) < par.count;)
+		par.cutoff++;
+	par.pending = 1;
+	par.workers = calloc(par.count, sizeof(tree_worker_t));
+	if (par.count == 1 || !par.workers)
+	{
+		free(par.workers);
+		return (tree_par_walk(&par, tree, 0));
+	}
+	for (i = 0; i < par.count; i++)
+	{
+		par.workers[i].par = &par;
+		par.workers[i].result = identity;
+		par.workers[i].seed = 2463534242u + i;
+		pthread_mutex_init(&par.workers[i].deque.lock, NULL);
+	}
+	if (!tree_deque_push(&par.workers[0].deque, tree, 0))
+	{
+		par.workers[0].result = tree_par_walk(&par, tree, 0);
+		par.pending = 0;
+	}
+	for (i = 1; i < par.count; i++)
+		if (pthread_create(&par.workers[i].thread, NULL,
+			tree_par_worker, par.workers + i))
+			break;
+	tree_par_worker(par.workers);
+	return (tree_par_join(&par, i - 1));
+}
@@ -0,0 +1,52 @@
+#include "binary_trees.h"
+/**
+* tree_par_sum - adds two counts
+* @a: first count
+* @b: second count
+* Return: a + b
+*/
+size_t tree_par_sum(size_t a, size_t b)
+{
+	return (a + b);
+}
+/**
+* tree_par_one - counts every node once
+* @node: pointer to the node
+* @depth: depth of the node, unused
+* Return: 1
+*/
+size_t tree_par_one(const binary_tree_t *node, size_t depth)
+{
+	(void)node;
+	(void)depth;
+	return (1);
+}
+/**
+* tree_par_leaf - counts the leaves
+* @node: pointer to the node
+* @depth: depth of the node, unused
+* Return: 1 if node is a leaf, 0 otherwise
+*/
+size_t tree_par_leaf(const binary_tree_t *node, size_t depth)
+{
+	(void)depth;
+	return (!node->left && !node->right);
+}
+/**
+* binary_tree_par_size - measures the size of a binary tree in parallel
+* @tree: pointer to the root node of the tree to measure the size
+* Return: size of the tree, 0 if tree is NULL
+*/
+size_t binary_tree_par_size(const binary_tree_t *tree)
+{
+	return (tree_par_reduce(tree, tree_par_one, tree_par_sum, 0));
+}
+/**
+* binary_tree_par_leaves - counts the leaves in a binary tree in parallel
+* @tree: pointer to the root node of the tree to count the leaves
+* Return: number of leaves, 0 if tree is NULL
+*/
+size_t binary_tree_par_leaves(const binary_tree_t *tree)
+{
+	return (tree_par_reduce(tree, tree_par_leaf, tree_par_sum, 0));
+}
@@ -0,0 +1,46 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * sum_values - Maps a node to its value
+ *
+ * @node: Pointer to the node
+ * @depth: Depth of the node, unused
+ *
+ * Return: Value of the node
+ */
+size_t sum_values(const binary_tree_t *node, size_t depth)
+{
+    (void)depth;
+    return ((size_t)node->n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: Always 0 (Success)
+ */
+int main(void)
+{
+    binary_tree_t *root;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    binary_tree_insert_right(root->left, 54);
+    binary_tree_insert_right(root, 128);
+    binary_tree_insert_left(root->right->right, 256);
+    binary_tree_print(root);
+
+    tree_par_threads(4);
+    printf("Size: %lu\n", binary_tree_par_size(root));
+    printf("Leaves: %lu\n", binary_tree_par_leaves(root));
+    printf("Nodes: %lu\n", binary_tree_par_nodes(root));
+    printf("Height: %lu\n", binary_tree_par_height(root));
+    printf("Sum: %lu\n", tree_par_reduce(root, sum_values, tree_par_sum, 0));
+    printf("Height of %d: %lu\n", root->right->n,
+           binary_tree_par_height(root->right));
+    binary_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,54 @@
+#include "binary_trees.h"
+/**
+* tree_par_inner - counts the nodes with at least 1 child
+* @node: pointer to the node
+* @depth: depth of the node, unused
+* Return: 1 if node has a child, 0 otherwise
+*/
+size_t tree_par_inner(const binary_tree_t *node, size_t depth)
+{
+	(void)depth;
+	return (node->left || node->right);
+}
+/**
+* tree_par_depth - maps a node to its depth
+* @node: pointer to the node, unused
+* @depth: depth of the node
+* Return: depth
+*/
+size_t tree_par_depth(const binary_tree_t *node, size_t depth)
+{
+	(void)node;
+	return (depth);
+}
+/**
+* tree_par_max - keeps the greater of two values
+* @a: first value
+* @b: second value
+* Return: the greater of a and b
+*/
+size_t tree_par_max(size_t a, size_t b)
+{
+	return (a > b ? a : b);
+}
+/**
+* binary_tree_par_nodes - counts the nodes with at least 1 child in a
+* binary tree in parallel
+* @tree: pointer to the root node of the tree to count the nodes
+* Return: number of nodes, 0 if tree is NULL
+*/
+size_t binary_tree_par_nodes(const binary_tree_t *tree)
+{
+	return (tree_par_reduce(tree, tree_par_inner, tree_par_sum, 0));
+}
+/**
+* binary_tree_par_height - measures the height of a binary tree in parallel
+* @tree: pointer to the root node of the tree to measure the height
+* Return: height of the tree, 0 if tree is NULL
+*
+* Description: the height is the depth of the deepest node.
+*/
+size_t binary_tree_par_height(const binary_tree_t *tree)
+{
+	return (tree_par_reduce(tree, tree_par_depth, tree_par_max, 0));
+}
@@ -0,0 +1,69 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * measure - Runs one counting function and prints its CSV line
+ *
+ * @mode: "seq" or "par"
+ * @threads: Number of threads
+ * @name: Name of the function
+ * @func: Counting function
+ * @tree: Tree to count
+ */
+void measure(const char *mode, size_t threads, const char *name,
+             size_t (*func)(const binary_tree_t *), const binary_tree_t *tree)
+{
+    struct timespec start, end;
+    size_t result;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    result = func(tree);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("%s,%lu,%s,%lu,%.2f\n", mode, (unsigned long)threads, name,
+           (unsigned long)result, (end.tv_sec - start.tv_sec) * 1e3 +
+           (end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+/**
+ * main - Benchmarks the sequential and parallel counting functions
+ * @ac: argument count
+ * @av: av[1] is the optional number of nodes, av[2] the optional largest
+ * thread count
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    avl_t *tree;
+    int *keys;
+    size_t i, n = 1000000, threads, max = 32;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    if (ac > 2)
+        max = strtoul(av[2], NULL, 10);
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys || !n || !max)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i;
+    tree = sorted_array_to_avl(keys, n);
+    free(keys);
+    if (!tree)
+        return (1);
+    printf("mode,threads,function,result,ms\n");
+    measure("seq", 1, "size", binary_tree_size, tree);
+    measure("seq", 1, "leaves", binary_tree_leaves, tree);
+    measure("seq", 1, "height", binary_tree_height, tree);
+    for (threads = 1; threads <= max; threads *= 2)
+    {
+        tree_par_threads(threads);
+        measure("par", threads, "size", binary_tree_par_size, tree);
+        measure("par", threads, "leaves", binary_tree_par_leaves, tree);
+        measure("par", threads, "height", binary_tree_par_height, tree);
+    }
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,131 @@
+#include "binary_trees.h"
+#include <limits.h>
+/**
+* tree_valid_node - checks a node above the cutoff depth against its context
+* @valid: pointer to the validation
+* @node: pointer to the node
+* @ctx: bounds, level-order index and depth of the node
+* Return: 1 if the node is valid, 0 otherwise
+*/
+int tree_valid_node(tree_valid_t *valid, const binary_tree_t *node,
+	const tree_check_t *ctx)
+{
+	if (valid->mode != TREE_VALID_HEAP)
+		return (node->n >= ctx->lo && node->n <= ctx->hi);
+	if (ctx->depth >= sizeof(size_t) * 8 ||
+		(node->left && node->left->n >= node->n) ||
+		(node->right && node->right->n >= node->n))
+		return (0);
+	if (ctx->depth < valid->cutoff)
+	{
+		valid->nodes++;
+		if (ctx->index > valid->max_index)
+			valid->max_index = ctx->index;
+	}
+	return (1);
+}
+/**
+* tree_valid_split - checks the nodes above the cutoff depth and records
+* the subtrees found at that depth as tasks, in preorder
+* @valid: pointer to the validation
+* @node: pointer to the current node
+* @ctx: bounds, level-order index and depth of the node
+* Return: 1 if the nodes checked are valid, 0 otherwise
+*/
+int tree_valid_split(tree_valid_t *valid, const binary_tree_t *node,
+	tree_check_t ctx)
+{
+	tree_check_t child = ctx;
+
+	if (!node)
+		return (1);
+	if (!tree_valid_node(valid, node, &ctx))
+		return (0);
+	if (ctx.depth == valid->cutoff)
+	{
+		ctx.node = node;
+		valid->tasks[valid->count++] = ctx;
+		return (1);
+	}
+	child.lo = node->n != INT_MIN ? ctx.lo : INT_MAX;
+	child.hi = node->n - (node->n != INT_MIN);
+	child.index = ctx.index * 2;
+	child.depth++;
+	if (!tree_valid_split(valid, node->left, child))
+		return (0);
+	child.lo = node->n + (node->n != INT_MAX);
+	child.hi = node->n != INT_MAX ? ctx.hi : INT_MIN;
+	child.index++;
+	return (tree_valid_split(valid, node->right, child));
+}
+/**
+* tree_valid_task - validates one subtree task with the checker of the mode
+* @valid: pointer to the validation
+* @task: pointer to the task
+* Return: 1 if the subtree is valid, 0 otherwise
+*/
+int tree_valid_task(tree_valid_t *valid, tree_check_t *task)
+{
+	if (valid->mode == TREE_VALID_BST)
+		return (tree_valid_bst(valid, task));
+	if (valid->mode == TREE_VALID_AVL)
+		return (tree_valid_avl(valid, task));
+	return (tree_valid_heap(valid, task));
+}
+/**
+* tree_valid_worker - validates tasks until none is left or one fails
+* @arg: pointer to the validation
+* Return: NULL
+*/
+void *tree_valid_worker(void *arg)
+{
+	tree_valid_t *valid = arg;
+	size_t i;
+
+	while (!__atomic_load_n(&valid->failed, __ATOMIC_RELAXED))
+	{
+		i = __atomic_fetch_add(&valid->next, 1, __ATOMIC_RELAXED);
+		if (i >= valid->count)
+			break;
+		if (!tree_valid_task(valid, valid->tasks + i))
+			__atomic_store_n(&valid->failed, 1, __ATOMIC_RELAXED);
+	}
+	return (NULL);
+}
+/**
+* tree_valid_run - validates a binary tree in parallel
+* @tree: pointer to the root node of the tree, not NULL
+* @mode: TREE_VALID_BST, TREE_VALID_AVL or TREE_VALID_HEAP
+* @valid: pointer to the validation to fill, its tasks to free by the caller
+* Return: 1 if every subtree is valid, 0 if one is not, -1 on failure
+*
+* Description: a depth holds at most 2^cutoff subtrees, so the tasks are
+* allocated once, about 64 per thread.
+*/
+int tree_valid_run(const binary_tree_t *tree, int mode, tree_valid_t *valid)
+{
+	pthread_t threads[256];
+	tree_check_t root = {NULL, INT_MIN, INT_MAX, 1, 0, 0, 0};
+	size_t i, count = tree_par_threads(0);
+
+	count = count < 256 ? count : 256;
+	valid->mode = mode;
+	valid->count = valid->next = 0;
+	valid->failed = 0;
+	valid->nodes = valid->max_index = 0;
+	for (valid->cutoff = 0; count > 1 &&
+		(size_t)1 << valid->cutoff < count * 64;)
+		valid->cutoff++;
+	valid->tasks = malloc(sizeof(tree_check_t) << valid->cutoff);
+	if (!valid->tasks)
+		return (-1);
+	if (!tree_valid_split(valid, tree, root))
+		return (0);
+	for (i = 1; i < count && i < valid->count; i++)
+		if (pthread_create(threads + i, NULL, tree_valid_worker, valid))
+			break;
+	tree_valid_worker(valid);
+	while (--i > 0)
+		pthread_join(threads[i], NULL);
+	return (!valid->failed);
+}
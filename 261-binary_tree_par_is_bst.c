@@ -0,0 +1,86 @@
+#include "binary_trees.h"
+#include <limits.h>
+/**
+* tree_valid_cancelled - checks every 1024 calls whether to stop a task
+* @valid: pointer to the validation
+* @seen: pointer to the number of nodes the task went through
+* Return: 1 if another worker found a violation, 0 otherwise
+*/
+int tree_valid_cancelled(tree_valid_t *valid, size_t *seen)
+{
+	return ((++*seen & 1023) == 0 &&
+		__atomic_load_n(&valid->failed, __ATOMIC_RELAXED));
+}
+/**
+* tree_valid_bst_child - bounds a child of a node of a BST subtree
+* @ctx: the node, with its bounds
+* @child: set to the child, with its bounds
+* @right: 1 for the right child, 0 for the left one
+* Return: pointer to the child node, NULL if there is none
+*/
+const binary_tree_t *tree_valid_bst_child(const tree_check_t *ctx,
+	tree_check_t *child, int right)
+{
+	int n = ctx->node->n;
+
+	*child = *ctx;
+	child->node = right ? ctx->node->right : ctx->node->left;
+	child->lo = right ? n + (n != INT_MAX) : (n != INT_MIN ? ctx->lo :
+		INT_MAX);
+	child->hi = right ? (n != INT_MAX ? ctx->hi : INT_MIN) : n -
+		(n != INT_MIN);
+	return (child->node);
+}
+/**
+* tree_valid_bst - checks that every value of a subtree lies within the
+* bounds its ancestors set
+* @valid: pointer to the validation
+* @task: pointer to the subtree task
+* Return: 1 if the subtree is valid, 0 otherwise
+*
+* Description: the pending children are kept on a stack of TREE_WALK_STACK
+* entries, and a child found with that stack full is checked by a nested
+* call, so the check reads only the child pointers.
+*/
+int tree_valid_bst(tree_valid_t *valid, tree_check_t *task)
+{
+	tree_check_t stack[TREE_WALK_STACK], ctx, child;
+	size_t size = 1, seen = 0;
+	int i;
+
+	stack[0] = *task;
+	while (size)
+	{
+		ctx = stack[--size];
+		if (ctx.node->n < ctx.lo || ctx.node->n > ctx.hi ||
+			tree_valid_cancelled(valid, &seen))
+			return (0);
+		for (i = 0; i < 2; i++)
+		{
+			if (!tree_valid_bst_child(&ctx, &child, i))
+				continue;
+			if (size < TREE_WALK_STACK)
+				stack[size++] = child;
+			else if (!tree_valid_bst(valid, &child))
+				return (0);
+		}
+	}
+	return (1);
+}
+/**
+* binary_tree_par_is_bst - checks in parallel if a binary tree is a valid
+* Binary Search Tree
+* @tree: pointer to the root node of the tree to check
+* Return: 1 if tree is a valid BST, and 0 otherwise
+*/
+int binary_tree_par_is_bst(const binary_tree_t *tree)
+{
+	tree_valid_t valid;
+	int ok;
+
+	if (!tree)
+		return (0);
+	ok = tree_valid_run(tree, TREE_VALID_BST, &valid);
+	free(valid.tasks);
+	return (ok == 1);
+}
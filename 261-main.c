@@ -0,0 +1,43 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    binary_tree_t *root;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    binary_tree_insert_right(root->left, 54);
+    binary_tree_insert_right(root, 128);
+    binary_tree_print(root);
+
+    tree_par_threads(4);
+    printf("Is %d BST: %d\n", root->n, binary_tree_par_is_bst(root));
+    printf("Is %d AVL: %d\n", root->n, binary_tree_par_is_avl(root));
+    printf("Is %d heap: %d\n", root->n, binary_tree_par_is_heap(root));
+    binary_tree_insert_right(root->left->right, 60);
+    printf("Is %d BST: %d\n", root->n, binary_tree_par_is_bst(root));
+    printf("Is %d AVL: %d\n", root->n, binary_tree_par_is_avl(root));
+    root->left->right->n = 99;
+    printf("Is %d BST: %d\n", root->n, binary_tree_par_is_bst(root));
+    printf("Is %d BST: %d\n", root->left->n,
+           binary_tree_par_is_bst(root->left));
+    binary_tree_delete(root);
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 90);
+    root->right = binary_tree_node(root, 85);
+    root->left->left = binary_tree_node(root->left, 80);
+    printf("Is %d heap: %d\n", root->n, binary_tree_par_is_heap(root));
+    root->right->right = binary_tree_node(root->right, 1);
+    printf("Is %d heap: %d\n", root->n, binary_tree_par_is_heap(root));
+    binary_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,99 @@
+#include "binary_trees.h"
+#include <limits.h>
+/**
+* tree_valid_avl_height - measures an AVL subtree within bounds
+* @valid: pointer to the validation
+* @node: pointer to the root node of the subtree
+* @ctx: bounds of the subtree, with its depth below the task root in depth
+* @seen: pointer to the number of nodes the task went through
+* Return: height of the subtree, -1 if it is not a valid AVL tree
+*
+* Description: no AVL subtree is more than 96 levels deep, so a deeper one
+* is rejected before it could exhaust the stack.
+*/
+int tree_valid_avl_height(tree_valid_t *valid, const binary_tree_t *node,
+	tree_check_t ctx, size_t *seen)
+{
+	tree_check_t child = ctx;
+	int left, right;
+
+	if (!node)
+		return (0);
+	if (node->n < ctx.lo || node->n > ctx.hi || ctx.depth > 96 ||
+		tree_valid_cancelled(valid, seen))
+		return (-1);
+	child.depth++;
+	child.lo = node->n != INT_MIN ? ctx.lo : INT_MAX;
+	child.hi = node->n - (node->n != INT_MIN);
+	left = tree_valid_avl_height(valid, node->left, child, seen);
+	if (left < 0)
+		return (-1);
+	child.lo = node->n + (node->n != INT_MAX);
+	child.hi = node->n != INT_MAX ? ctx.hi : INT_MIN;
+	right = tree_valid_avl_height(valid, node->right, child, seen);
+	if (right < 0 || left - right > 1 || right - left > 1)
+		return (-1);
+	return (1 + (left > right ? left : right));
+}
+/**
+* tree_valid_avl - checks that a subtree is an AVL tree within its bounds
+* @valid: pointer to the validation
+* @task: pointer to the subtree task, whose size is set to its height
+* Return: 1 if the subtree is valid, 0 otherwise
+*/
+int tree_valid_avl(tree_valid_t *valid, tree_check_t *task)
+{
+	tree_check_t ctx = *task;
+	size_t seen = 0;
+	int height;
+
+	ctx.depth = 0;
+	height = tree_valid_avl_height(valid, task->node, ctx, &seen);
+	if (height < 0)
+		return (0);
+	task->size = height;
+	return (1);
+}
+/**
+* tree_valid_avl_top - measures the part of a tree above the cutoff depth
+* from the heights of the tasks
+* @valid: pointer to the validation, all its tasks valid
+* @node: pointer to the current node
+* @depth: depth of node
+* @next: pointer to the index of the next task, in preorder
+* Return: height of the subtree, -1 if it is not balanced
+*/
+int tree_valid_avl_top(tree_valid_t *valid, const binary_tree_t *node,
+	size_t depth, size_t *next)
+{
+	int left, right;
+
+	if (!node)
+		return (0);
+	if (depth == valid->cutoff)
+		return ((int)valid->tasks[(*next)++].size);
+	left = tree_valid_avl_top(valid, node->left, depth + 1, next);
+	right = tree_valid_avl_top(valid, node->right, depth + 1, next);
+	if (left < 0 || right < 0 || left - right > 1 || right - left > 1)
+		return (-1);
+	return (1 + (left > right ? left : right));
+}
+/**
+* binary_tree_par_is_avl - checks in parallel if a binary tree is a valid
+* AVL Tree
+* @tree: pointer to the root node of the tree to check
+* Return: 1 if tree is a valid AVL Tree, and 0 otherwise
+*/
+int binary_tree_par_is_avl(const binary_tree_t *tree)
+{
+	tree_valid_t valid;
+	size_t next = 0;
+	int ok;
+
+	if (!tree)
+		return (0);
+	ok = tree_valid_run(tree, TREE_VALID_AVL, &valid) == 1 &&
+		tree_valid_avl_top(&valid, tree, 0, &next) >= 0;
+	free(valid.tasks);
+	return (ok);
+}
@@ -0,0 +1,74 @@
+#include "binary_trees.h"
+/**
+* tree_valid_heap_walk - checks a Max Binary Heap subtree, counting its
+* nodes and its greatest level-order index
+* @valid: pointer to the validation
+* @task: pointer to the task, whose size counts the nodes
+* @node: pointer to the current node
+* @index: level-order index of node, the root being 1
+* @depth: depth of node
+* Return: 1 if the subtree is valid, 0 otherwise
+*
+* Description: a complete tree is never as deep as size_t is wide, which
+* keeps both the index and the stack bounded.
+*/
+int tree_valid_heap_walk(tree_valid_t *valid, tree_check_t *task,
+	const binary_tree_t *node, size_t index, size_t depth)
+{
+	if (!node)
+		return (1);
+	if (depth >= sizeof(size_t) * 8 ||
+		(node->left && node->left->n >= node->n) ||
+		(node->right && node->right->n >= node->n) ||
+		tree_valid_cancelled(valid, &task->size))
+		return (0);
+	if (index > task->max_index)
+		task->max_index = index;
+	return (tree_valid_heap_walk(valid, task, node->left, index * 2,
+			depth + 1) &&
+		tree_valid_heap_walk(valid, task, node->right, index * 2 + 1,
+			depth + 1));
+}
+/**
+* tree_valid_heap - checks that a subtree is a Max Binary Heap, counting
+* its nodes and its greatest level-order index
+* @valid: pointer to the validation
+* @task: pointer to the subtree task
+* Return: 1 if the subtree is valid, 0 otherwise
+*/
+int tree_valid_heap(tree_valid_t *valid, tree_check_t *task)
+{
+	task->size = 0;
+	task->max_index = 0;
+	return (tree_valid_heap_walk(valid, task, task->node, task->index,
+		task->depth));
+}
+/**
+* binary_tree_par_is_heap - checks in parallel if a binary tree is a valid
+* Max Binary Heap
+* @tree: pointer to the root node of the tree to check
+* Return: 1 if tree is a valid Max Binary Heap, and 0 otherwise
+*
+* Description: the level-order indexes are all distinct, so the tree is
+* complete when its greatest index equals its number of nodes.
+*/
+int binary_tree_par_is_heap(const binary_tree_t *tree)
+{
+	tree_valid_t valid;
+	size_t i, nodes, max_index;
+	int ok;
+
+	if (!tree)
+		return (0);
+	ok = tree_valid_run(tree, TREE_VALID_HEAP, &valid) == 1;
+	nodes = valid.nodes;
+	max_index = valid.max_index;
+	for (i = 0; ok && i < valid.count; i++)
+	{
+		nodes += valid.tasks[i].size;
+		if (valid.tasks[i].max_index > max_index)
+			max_index = valid.tasks[i].max_index;
+	}
+	free(valid.tasks);
+	return (ok && nodes == max_index);
+}
@@ -0,0 +1,122 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * measure - Runs one validator and prints its CSV line
+ *
+ * @name: Name of the validator
+ * @threads: Number of threads, 0 for the sequential validator
+ * @tree: Label of the tree
+ * @func: Validator
+ * @root: Tree to validate
+ */
+void measure(const char *name, size_t threads, const char *tree,
+             int (*func)(const binary_tree_t *), const binary_tree_t *root)
+{
+    struct timespec start, end;
+    int verdict;
+
+    if (threads)
+        tree_par_threads(threads);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    verdict = func(root);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("%s,%lu,%s,%d,%.2f\n", name, (unsigned long)threads, tree,
+           verdict, (end.tv_sec - start.tv_sec) * 1e3 +
+           (end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+/**
+ * rightmost - Finds the last node of a tree in preorder
+ *
+ * @tree: Pointer to the root node of the tree
+ *
+ * Return: Pointer to the node
+ */
+binary_tree_t *rightmost(binary_tree_t *tree)
+{
+    while (tree->right || tree->left)
+        tree = tree->right ? tree->right : tree->left;
+    return (tree);
+}
+
+/**
+ * run - Times the validators on a tree, then on the tree with its last
+ * node broken
+ *
+ * @avl: Search tree, balanced
+ * @heap: Max Binary Heap
+ */
+void run(avl_t *avl, heap_t *heap)
+{
+    size_t threads[] = {1, 8, 32};
+    const char *label[] = {"valid", "broken"};
+    int pass, i, saved[2];
+
+    saved[0] = rightmost(avl)->n;
+    saved[1] = rightmost(heap)->n;
+    for (pass = 0; pass < 2; pass++)
+    {
+        if (pass)
+        {
+            rightmost(avl)->n = -1;
+            rightmost(heap)->n = 1 << 30;
+        }
+        measure("is_bst", 0, label[pass], binary_tree_is_bst, avl);
+        measure("is_avl", 0, label[pass], binary_tree_is_avl, avl);
+        for (i = 0; i < 3; i++)
+        {
+            measure("par_is_bst", threads[i], label[pass],
+                    binary_tree_par_is_bst, avl);
+            measure("par_is_avl", threads[i], label[pass],
+                    binary_tree_par_is_avl, avl);
+            measure("par_is_heap", threads[i], label[pass],
+                    binary_tree_par_is_heap, heap);
+        }
+    }
+    rightmost(avl)->n = saved[0];
+    rightmost(heap)->n = saved[1];
+}
+
+/**
+ * main - Benchmarks the parallel validators at 1, 8 and 32 threads
+ * @ac: argument count
+ * @av: av[1] is the optional number of nodes
+ *
+ * Return: 0 on success, error code on failure
+ *
+ * Description: binary_tree_is_heap walks a 100-node queue, so only the
+ * parallel heap validator runs on the large heap.
+ */
+int main(int ac, char **av)
+{
+    avl_t *avl;
+    heap_t *heap;
+    cheap_t compact;
+    size_t i, n = 1000000;
+    int *keys;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys || !n)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i;
+    avl = sorted_array_to_avl(keys, n);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)(n - i);
+    compact.keys = keys;
+    compact.size = compact.capacity = n;
+    heap = cheap_to_heap(&compact);
+    free(keys);
+    if (!avl || !heap)
+        return (1);
+    printf("validator,threads,tree,verdict,ms\n");
+    run(avl, heap);
+    binary_tree_delete(avl);
+    binary_tree_delete(heap);
+    return (0);
+}
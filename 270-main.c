@@ -0,0 +1,35 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: Always 0 (Success)
+ */
+int main(void)
+{
+    int array[1000];
+    avl_t *tree;
+    char *buf;
+    size_t len, i;
+
+    for (i = 0; i < 1000; i++)
+        array[i] = (int)i;
+    tree = sorted_array_to_avl(array, 15);
+    binary_tree_print(tree);
+    printf("\nDepth 3:\n");
+    binary_tree_fprint(stdout, tree, 3, 0);
+    printf("\nWidth 40:\n");
+    binary_tree_fprint(stdout, tree, 0, 40);
+    binary_tree_delete(tree);
+
+    tree = sorted_array_to_avl(array, 1000);
+    buf = binary_tree_render(tree, 0, 0, &len);
+    printf("\n1000 nodes: %lu bytes\n", (unsigned long)len);
+    free(buf);
+    printf("\n1000 nodes, depth 4, width 64:\n");
+    binary_tree_fprint(stdout, tree, 4, 64);
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,99 @@
+#include "binary_trees.h"
+/**
+* tree_write_varint - writes an unsigned integer as a little-endian base 128
+* varint, seven bits per byte
+* @stream: stream to write to
+* @value: integer to write
+* Return: 0 on success, -1 on failure
+*/
+int tree_write_varint(FILE *stream, unsigned long value)
+{
+	while (value >= 0x80)
+	{
+		if (putc((int)(value & 0x7f) | 0x80, stream) == EOF)
+			return (-1);
+		value >>= 7;
+	}
+	return (putc((int)value, stream) == EOF ? -1 : 0);
+}
+/**
+* tree_read_varint - reads an unsigned integer written by tree_write_varint
+* @stream: stream to read from
+* @value: where to store the integer
+* Return: 0 on success, -1 on a truncated or overlong varint
+*/
+int tree_read_varint(FILE *stream, unsigned long *value)
+{
+	unsigned int shift;
+	int c;
+
+	*value = 0;
+	for (shift = 0; shift < sizeof(*value) * 8; shift += 7)
+	{
+		c = getc(stream);
+		if (c == EOF)
+			return (-1);
+		*value |= (unsigned long)(c & 0x7f) << shift;
+		if (!(c & 0x80))
+			return (0);
+	}
+	return (-1);
+}
+/**
+* tree_write_key - writes a key of a serialized tree
+* @stream: stream to write to
+* @key: key to write
+* @prev: previous key written, used by TREE_SERIAL_DELTA
+* @flags: TREE_SERIAL_VARINT and TREE_SERIAL_DELTA encodings in use
+* Return: 0 on success, -1 on failure
+*
+* Description: keys are written as 4 little-endian bytes, or as zigzag
+* varints so that small negative values stay short, of the difference
+* with the previous key with TREE_SERIAL_DELTA.
+*/
+int tree_write_key(FILE *stream, int key, int prev, int flags)
+{
+	unsigned int u = (unsigned int)key, i;
+
+	if (flags & TREE_SERIAL_DELTA)
+		u -= (unsigned int)prev;
+	if (flags & (TREE_SERIAL_VARINT | TREE_SERIAL_DELTA))
+		return (tree_write_varint(stream, (u << 1) ^ (0u - (u >> 31))));
+	for (i = 0; i < 4; i++)
+		if (putc((int)(u >> (i * 8)) & 0xff, stream) == EOF)
+			return (-1);
+	return (0);
+}
+/**
+* tree_read_key - reads a key written by tree_write_key
+* @stream: stream to read from
+* @key: where to store the key
+* @prev: previous key read, used by TREE_SERIAL_DELTA
+* @flags: TREE_SERIAL_VARINT and TREE_SERIAL_DELTA encodings in use
+* Return: 0 on success, -1 on failure
+*/
+int tree_read_key(FILE *stream, int *key, int prev, int flags)
+{
+	unsigned long v = 0;
+	unsigned int u = 0, i;
+	int c;
+
+	if (flags & (TREE_SERIAL_VARINT | TREE_SERIAL_DELTA))
+	{
+		if (tree_read_varint(stream, &v) || v > 0xffffffffUL)
+			return (-1);
+		u = ((unsigned int)v >> 1) ^ (0u - ((unsigned int)v & 1));
+	}
+	else
+		for (i = 0; i < 4; i++)
+		{
+			c = getc(stream);
+			if (c == EOF)
+				return (-1);
+			u |= (unsigned int)c << (i * 8);
+		}
+	if (flags & TREE_SERIAL_DELTA)
+		u += (unsigned int)prev;
+	*key = u <= 0x7fffffffu ? (int)u : -(int)(~u) - 1;
+	return (0);
+}
@@ -0,0 +1,45 @@
+#include "binary_trees.h"
+/**
+* tree_preorder_next - finds the next node of a subtree in preorder
+* @node: pointer to the current node
+* @top: pointer to the root node of the subtree
+* Return: pointer to the next node, or NULL after the last one
+*/
+const binary_tree_t *tree_preorder_next(const binary_tree_t *node,
+	const binary_tree_t *top)
+{
+	if (node->left)
+		return (node->left);
+	if (node->right)
+		return (node->right);
+	for (; node != top; node = node->parent)
+		if (node == node->parent->left && node->parent->right)
+			return (node->parent->right);
+	return (NULL);
+}
+/**
+* tree_inorder_first - finds the first node of a subtree in in-order
+* @node: pointer to the root node of the subtree
+* Return: pointer to the leftmost node of the subtree
+*/
+const binary_tree_t *tree_inorder_first(const binary_tree_t *node)
+{
+	while (node->left)
+		node = node->left;
+	return (node);
+}
+/**
+* tree_inorder_next - finds the next node of a subtree in in-order
+* @node: pointer to the current node
+* @top: pointer to the root node of the subtree
+* Return: pointer to the next node, or NULL after the last one
+*/
+const binary_tree_t *tree_inorder_next(const binary_tree_t *node,
+	const binary_tree_t *top)
+{
+	if (node->right)
+		return (tree_inorder_first(node->right));
+	while (node != top && node == node->parent->right)
+		node = node->parent;
+	return (node == top ? NULL : node->parent);
+}
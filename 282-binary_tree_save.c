@@ -0,0 +1,93 @@
+#include "binary_trees.h"
+/**
+* tree_write_shape - writes the shape of a tree as a preorder bitmap, two
+* bits per node telling whether it has a left and a right child
+* @stream: stream to write to
+* @tree: pointer to the root node of the tree
+* @walk: pointer to the walk whose stack is reused
+* Return: 0 on success, -1 on failure
+*/
+int tree_write_shape(FILE *stream, const binary_tree_t *tree,
+	tree_walk_t *walk)
+{
+	const binary_tree_t *node;
+	unsigned int bits = 0, used = 0;
+	int ret;
+
+	tree_walk_start(walk, tree);
+	while ((ret = tree_walk_preorder(walk, &node)) == 1)
+	{
+		bits |= (unsigned int)(node->left != NULL) << used;
+		bits |= (unsigned int)(node->right != NULL) << (used + 1);
+		used += 2;
+		if (used == 8)
+		{
+			if (putc((int)bits, stream) == EOF)
+				return (-1);
+			bits = 0;
+			used = 0;
+		}
+	}
+	if (ret || (used && putc((int)bits, stream) == EOF))
+		return (-1);
+	return (0);
+}
+/**
+* tree_write_keys - writes the keys of a tree in in-order
+* @stream: stream to write to
+* @tree: pointer to the root node of the tree
+* @flags: encodings in use
+* @walk: pointer to the walk whose stack is reused
+* Return: 0 on success, -1 on failure
+*/
+int tree_write_keys(FILE *stream, const binary_tree_t *tree, int flags,
+	tree_walk_t *walk)
+{
+	const binary_tree_t *node;
+	int prev = 0, ret;
+
+	tree_walk_start(walk, tree);
+	while ((ret = tree_walk_inorder(walk, &node)) == 1)
+	{
+		if (tree_write_key(stream, node->n, prev, flags))
+			return (-1);
+		prev = node->n;
+	}
+	return (ret);
+}
+/**
+* binary_tree_save - serializes a binary tree, AVL tree or heap
+* @stream: stream to write to
+* @tree: pointer to the root node of the tree, may be NULL
+* @flags: TREE_SERIAL_VARINT or TREE_SERIAL_DELTA to compress the keys
+* Return: 0 on success, -1 on failure
+*
+* Description: the format is the TREE_SERIAL_MAGIC bytes, the version and
+* the flags, the number of nodes as a varint, the shape bitmap and the
+* keys in in-order, so that the keys of a BST are sorted and delta
+* encoding keeps them short. Every pass follows the child pointers only,
+* so the count, the shape and the keys always describe the same nodes.
+*/
+int binary_tree_save(FILE *stream, const binary_tree_t *tree, int flags)
+{
+	tree_walk_t walk = {NULL, 0, 0, NULL};
+	size_t count;
+	int ret = -1;
+
+	if (flags & ~(TREE_SERIAL_VARINT | TREE_SERIAL_DELTA) ||
+		tree_walk_count(&walk, tree, &count))
+	{
+		free(walk.nodes);
+		return (-1);
+	}
+	if (fwrite(TREE_SERIAL_MAGIC, 1, 4, stream) == 4 &&
+		putc(TREE_SERIAL_VERSION, stream) != EOF &&
+		putc(flags, stream) != EOF && !tree_write_varint(stream, count))
+		ret = 0;
+	if (!ret && tree)
+		ret = tree_write_shape(stream, tree, &walk);
+	if (!ret && tree)
+		ret = tree_write_keys(stream, tree, flags, &walk);
+	free(walk.nodes);
+	return (ret);
+}
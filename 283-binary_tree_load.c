@@ -0,0 +1,106 @@
+#include "binary_trees.h"
+#include <string.h>
+/**
+* tree_shape_next - finds where the node after a leaf or a node without a
+* left child goes, in preorder
+* @node: pointer to the node just created; the value of a node holds
+* whether it has a right child yet to create
+* @side: set to 1, the next node being a right child
+* Return: pointer to the parent of the next node, or NULL if the shape is
+* complete
+*/
+binary_tree_t *tree_shape_next(binary_tree_t *node, int *side)
+{
+	*side = 1;
+	if (node->n)
+	{
+		node->n = 0;
+		return (node);
+	}
+	for (; node->parent; node = node->parent)
+		if (node == node->parent->left && node->parent->n)
+		{
+			node->parent->n = 0;
+			return (node->parent);
+		}
+	return (NULL);
+}
+/**
+* tree_read_shape - rebuilds the nodes of a tree from its preorder bitmap
+* @stream: stream to read from
+* @count: number of nodes
+* Return: pointer to the root node of the tree, or NULL on failure
+*/
+binary_tree_t *tree_read_shape(FILE *stream, unsigned long count)
+{
+	binary_tree_t *root = NULL, *parent = NULL, *node;
+	unsigned long i;
+	int c = 0, side = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		if (i % 4 == 0)
+			c = getc(stream);
+		node = binary_tree_node(parent, 0);
+		if (c == EOF || !node || (i && !parent))
+		{
+			free(node);
+			binary_tree_delete(root);
+			return (NULL);
+		}
+		if (!parent)
+			root = node;
+		else if (side)
+			parent->right = node;
+		else
+			parent->left = node;
+		node->n = (c >> (i % 4 * 2 + 1)) & 1;
+		side = 0;
+		parent = node;
+		if (!((c >> (i % 4 * 2)) & 1))
+			parent = tree_shape_next(node, &side);
+	}
+	if (parent)
+		binary_tree_delete(root);
+	return (parent ? NULL : root);
+}
+/**
+* binary_tree_load - deserializes a tree written by binary_tree_save
+* @stream: stream to read from
+* @tree: where to store the pointer to the root node of the tree, NULL for
+* an empty tree
+* Return: 0 on success, -1 on a malformed stream or an allocation failure
+*/
+int binary_tree_load(FILE *stream, binary_tree_t **tree)
+{
+	char magic[4];
+	unsigned long count;
+	binary_tree_t *node;
+	int version, flags, prev = 0;
+
+	*tree = NULL;
+	version = fread(magic, 1, 4, stream) == 4 ? getc(stream) : EOF;
+	flags = getc(stream);
+	if (memcmp(magic, TREE_SERIAL_MAGIC, 4) ||
+		version != TREE_SERIAL_VERSION || flags == EOF ||
+		flags & ~(TREE_SERIAL_VARINT | TREE_SERIAL_DELTA) ||
+		tree_read_varint(stream, &count))
+		return (-1);
+	if (!count)
+		return (0);
+	*tree = tree_read_shape(stream, count);
+	if (!*tree)
+		return (-1);
+	for (node = (binary_tree_t *)tree_inorder_first(*tree); node;
+		node = (binary_tree_t *)tree_inorder_next(node, *tree))
+	{
+		if (tree_read_key(stream, &node->n, prev, flags))
+		{
+			binary_tree_delete(*tree);
+			*tree = NULL;
+			return (-1);
+		}
+		prev = node->n;
+	}
+	return (0);
+}
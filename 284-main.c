@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * round_trip - Saves a tree to a temporary file and loads it back
+ *
+ * @tree: Pointer to the root node of the tree to save
+ * @flags: Encoding of the keys
+ * @size: Set to the number of bytes written
+ *
+ * Return: Pointer to the root node of the loaded tree
+ */
+binary_tree_t *round_trip(const binary_tree_t *tree, int flags, long *size)
+{
+    binary_tree_t *copy = NULL;
+    FILE *file;
+
+    file = tmpfile();
+    if (!file)
+        return (NULL);
+    if (binary_tree_save(file, tree, flags) == 0)
+    {
+        *size = ftell(file);
+        rewind(file);
+        if (binary_tree_load(file, &copy) == -1)
+            printf("Failed to load\n");
+    }
+    fclose(file);
+    return (copy);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: Always 0 (Success)
+ */
+int main(void)
+{
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68,
+        79, 84, 87, 91, 95, 98
+    };
+    const char *names[] = {"raw", "varint", "delta"};
+    int flags[] = {0, TREE_SERIAL_VARINT, TREE_SERIAL_DELTA};
+    binary_tree_t *avl, *heap, *copy;
+    size_t i;
+    long size;
+
+    avl = sorted_array_to_avl(array, 16);
+    heap = array_to_heap(array, 16);
+    binary_tree_print(avl);
+    binary_tree_print(heap);
+    for (i = 0; i < 3; i++)
+    {
+        copy = round_trip(avl, flags[i], &size);
+        printf("AVL %s: %ld bytes, is AVL: %d\n", names[i], size,
+               binary_tree_is_avl(copy));
+        binary_tree_delete(copy);
+        copy = round_trip(heap, flags[i], &size);
+        printf("Heap %s: %ld bytes, is heap: %d\n", names[i], size,
+               binary_tree_is_heap(copy));
+        if (i == 2)
+            binary_tree_print(copy);
+        binary_tree_delete(copy);
+    }
+    binary_tree_delete(avl);
+    binary_tree_delete(heap);
+    return (0);
+}
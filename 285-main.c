@@ -0,0 +1,87 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * report - prints one CSV line of the benchmark
+ * @method: name of the reload method
+ * @start: clock value at the start of the run
+ * @nodes: number of nodes reloaded
+ * @bytes: size of the image read, 0 if none
+ */
+void report(const char *method, clock_t start, size_t nodes, long bytes)
+{
+    printf("%s,%lu,%ld,%.1f\n", method, (unsigned long)nodes, bytes,
+           (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / nodes);
+}
+
+/**
+ * reload - Saves an AVL tree and times loading it back
+ * @avl: pointer to the root node of the tree
+ * @method: name of the encoding
+ * @flags: encoding of the keys
+ * @n: number of nodes of the tree
+ *
+ * Return: 0 if the loaded tree is a valid AVL tree, 1 otherwise
+ */
+int reload(const avl_t *avl, const char *method, int flags, size_t n)
+{
+    binary_tree_t *copy = NULL;
+    clock_t start;
+    FILE *file;
+    long bytes;
+    int ret;
+
+    file = tmpfile();
+    if (!file || binary_tree_save(file, avl, flags) == -1)
+        return (1);
+    bytes = ftell(file);
+    rewind(file);
+    start = clock();
+    ret = binary_tree_load(file, &copy);
+    report(method, start, n, bytes);
+    fclose(file);
+    ret = ret || !binary_tree_par_is_avl(copy);
+    binary_tree_delete(copy);
+    return (ret);
+}
+
+/**
+ * main - Benchmarks reloading an AVL tree from its serialization against
+ * inserting its keys again
+ * @ac: argument count
+ * @av: av[1] is the optional number of keys
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    avl_t *avl = NULL, *rebuilt = NULL;
+    size_t i, n = 20000;
+    int *keys;
+    clock_t start;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys || !n)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i * 3 + rand() % 3;
+    avl = sorted_array_to_avl(keys, n);
+    printf("method,nodes,bytes,ns_per_node\n");
+    start = clock();
+    for (i = 0; i < n; i++)
+        avl_insert(&rebuilt, keys[(i * 7919) % n]);
+    report("avl_insert", start, n, 0);
+    if (reload(avl, "load_raw", 0, n) ||
+        reload(avl, "load_varint", TREE_SERIAL_VARINT, n) ||
+        reload(avl, "load_delta", TREE_SERIAL_DELTA, n))
+        return (1);
+    binary_tree_delete(rebuilt);
+    binary_tree_delete(avl);
+    free(keys);
+    return (0);
+}
@@ -0,0 +1,93 @@
+#include "binary_trees.h"
+/**
+* tree_walk_push - pushes a node on the stack of a walk
+* @walk: pointer to the walk
+* @node: node to push
+* Return: 0 on success, -1 on failure
+*/
+int tree_walk_push(tree_walk_t *walk, const binary_tree_t *node)
+{
+	const binary_tree_t **nodes;
+	size_t capacity;
+
+	if (walk->size == walk->capacity)
+	{
+		capacity = walk->capacity ? walk->capacity * 2 : 32;
+		nodes = realloc(walk->nodes, sizeof(*nodes) * capacity);
+		if (!nodes)
+			return (-1);
+		walk->nodes = nodes;
+		walk->capacity = capacity;
+	}
+	walk->nodes[walk->size++] = node;
+	return (0);
+}
+/**
+* tree_walk_start - starts a walk over a tree, reusing its stack
+* @walk: pointer to the walk
+* @tree: pointer to the root node of the tree, may be NULL
+* Return: void
+*/
+void tree_walk_start(tree_walk_t *walk, const binary_tree_t *tree)
+{
+	walk->size = 0;
+	walk->next = tree;
+}
+/**
+* tree_walk_preorder - moves a walk to its next node in preorder
+* @walk: pointer to the walk
+* @node: set to the next node
+* Return: 1 if a node was found, 0 after the last one, -1 on failure
+*
+* Description: the right children wait on the stack while the walk goes
+* left, so only the child pointers are read.
+*/
+int tree_walk_preorder(tree_walk_t *walk, const binary_tree_t **node)
+{
+	if (!walk->next && !walk->size)
+		return (0);
+	*node = walk->next ? walk->next : walk->nodes[--walk->size];
+	walk->next = (*node)->left;
+	if ((*node)->right && tree_walk_push(walk, (*node)->right))
+		return (-1);
+	return (1);
+}
+/**
+* tree_walk_inorder - moves a walk to its next node in in-order
+* @walk: pointer to the walk
+* @node: set to the next node
+* Return: 1 if a node was found, 0 after the last one, -1 on failure
+*
+* Description: the ancestors still to visit wait on the stack, so only the
+* child pointers are read.
+*/
+int tree_walk_inorder(tree_walk_t *walk, const binary_tree_t **node)
+{
+	for (; walk->next; walk->next = walk->next->left)
+		if (tree_walk_push(walk, walk->next))
+			return (-1);
+	if (!walk->size)
+		return (0);
+	*node = walk->nodes[--walk->size];
+	walk->next = (*node)->right;
+	return (1);
+}
+/**
+* tree_walk_count - counts the nodes of a tree
+* @walk: pointer to the walk, whose stack is reused
+* @tree: pointer to the root node of the tree, may be NULL
+* @count: set to the number of nodes
+* Return: 0 on success, -1 on failure
+*/
+int tree_walk_count(tree_walk_t *walk, const binary_tree_t *tree,
+	size_t *count)
+{
+	const binary_tree_t *node;
+	int ret;
+
+	*count = 0;
+	tree_walk_start(walk, tree);
+	while ((ret = tree_walk_preorder(walk, &node)) == 1)
+		++*count;
+	return (ret);
+}
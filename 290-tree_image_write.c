@@ -0,0 +1,96 @@
+#include "binary_trees.h"
+#include <limits.h>
+#include <string.h>
+/**
+* tree_image_first - finds the first slot of an Eytzinger array in order
+* @count: number of keys, at least 1
+* Return: index of the leftmost slot, slots being numbered from 1
+*/
+size_t tree_image_first(size_t count)
+{
+	size_t i = 1;
+
+	while (i * 2 <= count)
+		i *= 2;
+	return (i);
+}
+/**
+* tree_image_next - finds the next slot of an Eytzinger array in order
+* @i: index of the current slot
+* @count: number of keys
+* Return: index of the next slot, or 0 after the last one
+*
+* Description: slot i has its children at 2i and 2i + 1, so the walk is an
+* in-order walk of an implicit tree, climbing by halving the index.
+*/
+size_t tree_image_next(size_t i, size_t count)
+{
+	if (i * 2 + 1 <= count)
+	{
+		i = i * 2 + 1;
+		while (i * 2 <= count)
+			i *= 2;
+		return (i);
+	}
+	while (i & 1)
+		i >>= 1;
+	return (i >> 1);
+}
+/**
+* tree_image_fill - places the keys of a tree in Eytzinger order
+* @tree: pointer to the root node of the tree, not NULL
+* @keys: array of count keys to fill
+* @count: number of nodes of the tree
+* @walk: pointer to the walk whose stack is reused
+* Return: 0 on success, -1 on failure or if the tree does not hold
+* exactly count nodes
+*/
+int tree_image_fill(const bst_t *tree, int *keys, size_t count,
+	tree_walk_t *walk)
+{
+	const binary_tree_t *node;
+	size_t i, n;
+
+	tree_walk_start(walk, tree);
+	for (n = 0, i = tree_image_first(count); n < count; n++)
+	{
+		if (!i || tree_walk_inorder(walk, &node) != 1)
+			return (-1);
+		keys[i - 1] = node->n;
+		i = tree_image_next(i, count);
+	}
+	return (tree_walk_inorder(walk, &node) == 0 ? 0 : -1);
+}
+/**
+* tree_image_write - writes the frozen image of a Binary Search Tree
+* @stream: stream to write to
+* @tree: pointer to the root node of the BST or AVL tree, may be NULL
+* Return: 0 on success, -1 on failure
+*
+* Description: the image is a TREE_IMAGE_HEADER bytes header followed by
+* the keys in Eytzinger order, with no pointers, so it can be mapped
+* anywhere and searched in place.
+*/
+int tree_image_write(FILE *stream, const bst_t *tree)
+{
+	tree_walk_t walk = {NULL, 0, 0, NULL};
+	unsigned int header[4];
+	size_t count;
+	int *keys = NULL, ret = -1;
+
+	if (!tree_walk_count(&walk, tree, &count) && count <= UINT_MAX)
+		keys = malloc(sizeof(*keys) * (count ? count : 1));
+	if (keys && (!count || !tree_image_fill(tree, keys, count, &walk)))
+	{
+		memcpy(header, TREE_IMAGE_MAGIC, 4);
+		header[1] = TREE_IMAGE_VERSION;
+		header[2] = TREE_IMAGE_ORDER;
+		header[3] = (unsigned int)count;
+		ret = fwrite(header, 1, sizeof(header), stream) ==
+			sizeof(header) && fwrite(keys, sizeof(*keys), count,
+			stream) == count ? 0 : -1;
+	}
+	free(keys);
+	free(walk.nodes);
+	return (ret);
+}
@@ -0,0 +1,54 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_value - Prints a value
+ *
+ * @value: Value to print
+ */
+void print_value(int value)
+{
+    printf("(%03d)", value);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_t *tree;
+    tree_image_t image;
+    FILE *file;
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68,
+        79, 84, 87, 91, 95, 98
+    };
+    int floor, values[] = {0, 22, 50, 98, 120};
+    size_t i;
+
+    tree = sorted_array_to_avl(array, 16);
+    binary_tree_print(tree);
+    file = fopen("tree.img", "wb");
+    if (!file || tree_image_write(file, tree) == -1 || fclose(file))
+        return (1);
+    binary_tree_delete(tree);
+    if (tree_image_open("tree.img", &image) == -1)
+        return (1);
+    for (i = 0; i < 5; i++)
+    {
+        printf("%d: found %d", values[i],
+               tree_image_search(&image, values[i]));
+        if (tree_image_floor(&image, values[i], &floor))
+            printf(", floor %d", floor);
+        printf("\n");
+    }
+    printf("Range [20, 70]: ");
+    i = tree_image_range(&image, 20, 70, print_value);
+    printf("\n%lu values\n", (unsigned long)i);
+    tree_image_close(&image);
+    remove("tree.img");
+    return (0);
+}
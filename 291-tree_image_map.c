@@ -0,0 +1,76 @@
+#include "binary_trees.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+/**
+* tree_image_map - checks a tree image in memory and points an image at it,
+* without copying it
+* @bytes: pointer to the image, aligned on an int
+* @size: size of the image in bytes
+* @image: image to set up
+* Return: 0 on success, -1 if the bytes are not a valid image
+*/
+int tree_image_map(const void *bytes, size_t size, tree_image_t *image)
+{
+	unsigned int header[4];
+
+	if (size < TREE_IMAGE_HEADER || (size_t)bytes % sizeof(int))
+		return (-1);
+	memcpy(header, bytes, sizeof(header));
+	if (memcmp(header, TREE_IMAGE_MAGIC, 4) ||
+		header[1] != TREE_IMAGE_VERSION ||
+		header[2] != TREE_IMAGE_ORDER ||
+		header[3] > (size - TREE_IMAGE_HEADER) / sizeof(int))
+		return (-1);
+	image->keys = (const int *)bytes + TREE_IMAGE_HEADER / sizeof(int) - 1;
+	image->count = header[3];
+	image->map = NULL;
+	image->size = size;
+	return (0);
+}
+/**
+* tree_image_open - maps a tree image file read-only
+* @path: path of the file written by tree_image_write
+* @image: image to set up, to be closed with tree_image_close
+* Return: 0 on success, -1 on failure
+*/
+int tree_image_open(const char *path, tree_image_t *image)
+{
+	struct stat st;
+	void *map;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (-1);
+	if (fstat(fd, &st) == -1 || st.st_size < TREE_IMAGE_HEADER)
+	{
+		close(fd);
+		return (-1);
+	}
+	map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (-1);
+	if (tree_image_map(map, (size_t)st.st_size, image) == -1)
+	{
+		munmap(map, (size_t)st.st_size);
+		return (-1);
+	}
+	image->map = map;
+	return (0);
+}
+/**
+* tree_image_close - unmaps a tree image opened by tree_image_open
+* @image: image to close
+*/
+void tree_image_close(tree_image_t *image)
+{
+	if (image->map)
+		munmap(image->map, image->size);
+	image->map = NULL;
+	image->keys = NULL;
+	image->count = 0;
+}
@@ -0,0 +1,82 @@
+#include "binary_trees.h"
+/**
+* tree_image_lower - finds the slot of the smallest key of a tree image
+* greater than or equal to a value
+* @image: pointer to the image
+* @value: value to look for
+* Return: index of the slot, or 0 if every key is smaller
+*
+* Description: the descent has no branch to mispredict, and prefetches the
+* cache line holding the slots four levels below the current one.
+*/
+size_t tree_image_lower(const tree_image_t *image, int value)
+{
+	const int *keys = image->keys;
+	size_t i = 1;
+
+	while (i <= image->count)
+	{
+		__builtin_prefetch(keys + i * 16);
+		i = i * 2 + (keys[i] < value);
+	}
+	return (i >> __builtin_ffsl((long)~i));
+}
+/**
+* tree_image_search - searches for a value in a tree image
+* @image: pointer to the image
+* @value: value to search
+* Return: 1 if the value is in the image, 0 otherwise
+*/
+int tree_image_search(const tree_image_t *image, int value)
+{
+	size_t i = tree_image_lower(image, value);
+
+	return (i && image->keys[i] == value);
+}
+/**
+* tree_image_floor - finds the greatest key of a tree image lower than or
+* equal to a value
+* @image: pointer to the image
+* @value: value to look for
+* @floor: where to store the key found
+* Return: 1 if such a key exists, 0 otherwise
+*/
+int tree_image_floor(const tree_image_t *image, int value, int *floor)
+{
+	const int *keys = image->keys;
+	size_t i = 1, found = 0;
+
+	while (i <= image->count)
+	{
+		found = keys[i] <= value ? i : found;
+		i = i * 2 + (keys[i] <= value);
+	}
+	if (found)
+		*floor = keys[found];
+	return (found != 0);
+}
+/**
+* tree_image_range - goes through the keys of a tree image within a range,
+* in order
+* @image: pointer to the image
+* @lo: smallest value of the range
+* @hi: greatest value of the range
+* @func: pointer to a function to call for each key, may be NULL
+* Return: number of keys in the range
+*/
+size_t tree_image_range(const tree_image_t *image, int lo, int hi,
+	void (*func)(int))
+{
+	size_t i, found = 0;
+
+	if (lo > hi)
+		return (0);
+	for (i = tree_image_lower(image, lo); i && image->keys[i] <= hi;
+		i = tree_image_next(i, image->count))
+	{
+		if (func)
+			func(image->keys[i]);
+		found++;
+	}
+	return (found);
+}
@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * report - prints one CSV line of the benchmark
+ * @tree: name of the structure
+ * @op: name of the operation
+ * @start: clock value at the start of the run
+ * @ops: number of operations performed
+ */
+void report(const char *tree, const char *op, clock_t start, size_t ops)
+{
+    printf("%s,%s,%lu,%.1f\n", tree, op, (unsigned long)ops,
+           (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / ops);
+}
+
+/**
+ * save - Writes a tree to a file, as an image or a serialization
+ * @path: path of the file
+ * @avl: pointer to the root node of the tree
+ * @image: 1 to write an image, 0 to serialize
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int save(const char *path, const avl_t *avl, int image)
+{
+    FILE *file = fopen(path, "wb");
+    int ret;
+
+    if (!file)
+        return (-1);
+    if (image)
+        ret = tree_image_write(file, avl);
+    else
+        ret = binary_tree_save(file, avl, TREE_SERIAL_DELTA);
+    return (fclose(file) || ret ? -1 : 0);
+}
+
+/**
+ * main - Benchmarks a mapped tree image against reloading and searching
+ * an AVL tree
+ * @ac: argument count
+ * @av: av[1] is the optional number of keys
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    avl_t *avl, *copy = NULL;
+    tree_image_t image;
+    size_t i, n = 1000000;
+    int *keys, *probes, floor;
+    clock_t start;
+    FILE *file;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    keys = malloc(sizeof(*keys) * n);
+    probes = malloc(sizeof(*probes) * n);
+    if (!keys || !probes || !n)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+    {
+        keys[i] = (int)i * 2;
+        probes[i] = rand() % (int)(2 * n);
+    }
+    avl = sorted_array_to_avl(keys, n);
+    if (save("tree.img", avl, 1) || save("tree.bin", avl, 0))
+        return (1);
+    printf("tree,op,count,ns_per_op\n");
+    start = clock();
+    file = fopen("tree.bin", "rb");
+    if (!file || binary_tree_load(file, &copy) == -1)
+        return (1);
+    fclose(file);
+    report("avl", "load", start, n);
+    start = clock();
+    if (tree_image_open("tree.img", &image) == -1)
+        return (1);
+    report("image", "open", start, n);
+    start = clock();
+    for (i = 0; i < n; i++)
+        bst_search(copy, probes[i]);
+    report("avl", "search", start, n);
+    start = clock();
+    for (i = 0; i < n; i++)
+        tree_image_search(&image, probes[i]);
+    report("image", "search", start, n);
+    start = clock();
+    for (i = 0; i < n; i++)
+        tree_image_floor(&image, probes[i], &floor);
+    report("image", "floor", start, n);
+    start = clock();
+    for (i = 0; i < n / 100; i++)
+        tree_image_range(&image, probes[i], probes[i] + 200, NULL);
+    report("image", "range_100", start, n / 100 ? n / 100 : 1);
+    tree_image_close(&image);
+    remove("tree.img");
+    remove("tree.bin");
+    binary_tree_delete(avl);
+    binary_tree_delete(copy);
+    free(keys);
+    free(probes);
+    return (0);
+}
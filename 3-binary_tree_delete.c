@@ -10,5 +10,6 @@ void binary_tree_delete(binary_tree_t *tree)
 		return;
 	binary_tree_delete(tree->left);
 	binary_tree_delete(tree->right);
+	TREE_STAT_ADD(frees, 1);
 	free(tree);
 }
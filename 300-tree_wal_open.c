@@ -0,0 +1,89 @@
+#include "binary_trees.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+/**
+* tree_wal_path - builds the path of a file of a logged tree
+* @path: base path of the tree
+* @suffix: suffix of the file
+* Return: the path, to be freed, or NULL on failure
+*/
+char *tree_wal_path(const char *path, const char *suffix)
+{
+	char *full = malloc(strlen(path) + strlen(suffix) + 1);
+
+	if (full)
+	{
+		strcpy(full, path);
+		strcat(full, suffix);
+	}
+	return (full);
+}
+/**
+* tree_wal_load - loads the snapshot of a logged tree, if there is one
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_load(tree_wal_t *wal)
+{
+	FILE *file = fopen(wal->snap, "rb");
+	int ret;
+
+	if (!file)
+		return (errno == ENOENT ? 0 : -1);
+	ret = binary_tree_load(file, &wal->root);
+	fclose(file);
+	return (ret);
+}
+/**
+* tree_wal_open - opens a durable AVL tree, recovering it from its snapshot
+* and its mutation log
+* @path: base path of the tree, the files are path.snap and path.log
+* @batch: number of mutations committed together, 1 to sync every one
+* Return: pointer to the logged tree, or NULL on failure
+*/
+tree_wal_t *tree_wal_open(const char *path, size_t batch)
+{
+	tree_wal_t *wal = calloc(1, sizeof(*wal));
+
+	if (!wal)
+		return (NULL);
+	wal->fd = -1;
+	wal->batch = batch ? batch : 1;
+	wal->log = tree_wal_path(path, TREE_WAL_LOG);
+	wal->snap = tree_wal_path(path, TREE_WAL_SNAP);
+	if (wal->log && wal->snap)
+		wal->fd = open(wal->log, O_RDWR | O_CREAT | O_APPEND, 0644);
+	if (wal->fd == -1 || tree_wal_load(wal) == -1 ||
+		tree_wal_replay(wal) == -1)
+	{
+		tree_wal_close(wal);
+		return (NULL);
+	}
+	return (wal);
+}
+/**
+* tree_wal_close - commits the pending mutations of a logged tree and
+* releases it
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 if the last mutations could not be committed
+*/
+int tree_wal_close(tree_wal_t *wal)
+{
+	int ret = 0;
+
+	if (!wal)
+		return (0);
+	if (wal->fd != -1)
+	{
+		ret = tree_wal_commit(wal);
+		if (close(wal->fd) == -1)
+			ret = -1;
+	}
+	binary_tree_delete(wal->root);
+	free(wal->log);
+	free(wal->snap);
+	free(wal);
+	return (ret);
+}
@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    tree_wal_t *wal;
+    int array[] = {
+        98, 402, 12, 46, 128, 256, 512, 50
+    };
+    size_t i;
+
+    wal = tree_wal_open("tree", 4);
+    if (!wal)
+        return (1);
+    for (i = 0; i < 8; i++)
+        tree_wal_insert(wal, array[i]);
+    tree_wal_remove(wal, 128);
+    binary_tree_print(wal->root);
+    tree_wal_close(wal);
+
+    wal = tree_wal_open("tree", 4);
+    if (!wal)
+        return (1);
+    printf("\nRecovered from the log:\n");
+    binary_tree_print(wal->root);
+    if (tree_wal_checkpoint(wal) == -1)
+        return (1);
+    tree_wal_remove(wal, 98);
+    tree_wal_insert(wal, 1024);
+    tree_wal_close(wal);
+
+    wal = tree_wal_open("tree", 4);
+    if (!wal)
+        return (1);
+    printf("\nRecovered from the snapshot and the log:\n");
+    binary_tree_print(wal->root);
+    tree_wal_close(wal);
+    unlink("tree.log");
+    unlink("tree.snap");
+    return (0);
+}
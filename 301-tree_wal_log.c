@@ -0,0 +1,114 @@
+#include "binary_trees.h"
+#include <string.h>
+#include <unistd.h>
+/**
+* tree_wal_flush - writes the buffered records of a logged tree to its log
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure, the records not written staying
+* buffered
+*/
+int tree_wal_flush(tree_wal_t *wal)
+{
+	size_t done = 0;
+	ssize_t n;
+
+	while (done < wal->used)
+	{
+		n = write(wal->fd, wal->buf + done, wal->used - done);
+		if (n <= 0)
+		{
+			memmove(wal->buf, wal->buf + done, wal->used - done);
+			wal->used -= done;
+			return (-1);
+		}
+		done += (size_t)n;
+	}
+	wal->used = 0;
+	return (0);
+}
+/**
+* tree_wal_commit - makes every mutation of a logged tree durable
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure
+*
+* Description: the records buffered since the last commit reach the disk
+* with a single fsync, which is what amortizes the cost of durability.
+*/
+int tree_wal_commit(tree_wal_t *wal)
+{
+	if (!wal->pending)
+		return (0);
+	if (tree_wal_flush(wal) == -1 || fsync(wal->fd) == -1)
+		return (-1);
+	wal->pending = 0;
+	return (0);
+}
+/**
+* tree_wal_append - buffers a mutation record of a logged tree
+* @wal: pointer to the logged tree
+* @op: TREE_WAL_INSERT or TREE_WAL_REMOVE
+* @value: value inserted or removed
+* Return: 0 on success, -1 if the buffer is full and cannot be written
+*/
+int tree_wal_append(tree_wal_t *wal, int op, int value)
+{
+	unsigned int u = (unsigned int)value, i;
+
+	if (wal->used + TREE_WAL_RECORD > sizeof(wal->buf) &&
+		tree_wal_flush(wal) == -1)
+		return (-1);
+	wal->buf[wal->used++] = (unsigned char)op;
+	for (i = 0; i < 4; i++)
+		wal->buf[wal->used++] = (unsigned char)(u >> (i * 8));
+	wal->pending++;
+	return (0);
+}
+/**
+* tree_wal_insert - inserts a value in a logged tree
+* @wal: pointer to the logged tree
+* @value: value to insert
+* Return: pointer to the created node, or NULL if the value is already
+* present or on failure
+*
+* Description: when the insertion completes a batch whose commit fails,
+* the value stays inserted, NULL is returned and tree_wal_commit can be
+* retried.
+*/
+avl_t *tree_wal_insert(tree_wal_t *wal, int value)
+{
+	avl_t *node;
+
+	if (bst_search(wal->root, value) ||
+		tree_wal_append(wal, TREE_WAL_INSERT, value) == -1)
+		return (NULL);
+	node = avl_insert(&wal->root, value);
+	if (!node)
+	{
+		wal->used -= TREE_WAL_RECORD;
+		wal->pending--;
+		return (NULL);
+	}
+	if (wal->pending >= wal->batch && tree_wal_commit(wal) == -1)
+		return (NULL);
+	return (node);
+}
+/**
+* tree_wal_remove - removes a value from a logged tree
+* @wal: pointer to the logged tree
+* @value: value to remove
+* Return: 1 if the value was removed, 0 if it is absent, -1 on failure
+*
+* Description: as with tree_wal_insert, a failed batch commit leaves the
+* value removed.
+*/
+int tree_wal_remove(tree_wal_t *wal, int value)
+{
+	if (!bst_search(wal->root, value))
+		return (0);
+	if (tree_wal_append(wal, TREE_WAL_REMOVE, value) == -1)
+		return (-1);
+	wal->root = avl_remove(wal->root, value);
+	if (wal->pending >= wal->batch && tree_wal_commit(wal) == -1)
+		return (-1);
+	return (1);
+}
@@ -0,0 +1,134 @@
+#include "binary_trees.h"
+#include <sys/stat.h>
+#include <unistd.h>
+/**
+* tree_wal_cmp - orders mutation records by value, then by log position
+* @a: pointer to the first record
+* @b: pointer to the second record
+* Return: negative, zero or positive as a sorts before, with or after b
+*/
+int tree_wal_cmp(const void *a, const void *b)
+{
+	const tree_wal_rec_t *x = a, *y = b;
+
+	if (x->key != y->key)
+		return (x->key < y->key ? -1 : 1);
+	return (x->seq < y->seq ? -1 : x->seq > y->seq);
+}
+/**
+* tree_wal_read - reads the records of the log of a logged tree, cutting
+* off a torn record left by a crash
+* @wal: pointer to the logged tree
+* @count: set to the number of records
+* Return: the records, to be freed, or NULL on failure
+*/
+tree_wal_rec_t *tree_wal_read(tree_wal_t *wal, size_t *count)
+{
+	struct stat st;
+	unsigned char *raw, *rec;
+	tree_wal_rec_t *recs = NULL;
+	size_t size, done = 0;
+	ssize_t n = 1;
+
+	if (fstat(wal->fd, &st) == -1)
+		return (NULL);
+	size = (size_t)st.st_size;
+	raw = malloc(size + 1);
+	while (raw && done < size && n > 0)
+	{
+		n = pread(wal->fd, raw + done, size - done, (off_t)done);
+		done += n > 0 ? (size_t)n : 0;
+	}
+	if (raw && done == size)
+		recs = malloc(sizeof(*recs) * (size / TREE_WAL_RECORD + 1));
+	for (*count = 0; recs && *count < size / TREE_WAL_RECORD; (*count)++)
+	{
+		rec = raw + *count * TREE_WAL_RECORD;
+		if (rec[0] != TREE_WAL_INSERT && rec[0] != TREE_WAL_REMOVE)
+			break;
+		recs[*count].op = rec[0];
+		recs[*count].seq = *count;
+		recs[*count].key = (int)((unsigned int)rec[1] |
+			(unsigned int)rec[2] << 8 | (unsigned int)rec[3] << 16 |
+			(unsigned int)rec[4] << 24);
+	}
+	free(raw);
+	if (recs && *count * TREE_WAL_RECORD < size &&
+		ftruncate(wal->fd, (off_t)(*count * TREE_WAL_RECORD)) == -1)
+	{
+		free(recs);
+		return (NULL);
+	}
+	return (recs);
+}
+/**
+* tree_wal_merge - merges the values of a tree with sorted mutations, the
+* last mutation of each value deciding whether it is kept
+* @root: pointer to the root node of the tree
+* @recs: records sorted by tree_wal_cmp
+* @count: number of records
+* @keys: array receiving the resulting values, in order
+* Return: number of resulting values
+*/
+size_t tree_wal_merge(const avl_t *root, const tree_wal_rec_t *recs,
+	size_t count, int *keys)
+{
+	const binary_tree_t *node = root ? tree_inorder_first(root) : NULL;
+	size_t i = 0, j, size = 0;
+
+	while (node || i < count)
+	{
+		if (node && (i >= count || node->n < recs[i].key))
+		{
+			keys[size++] = node->n;
+			node = tree_inorder_next(node, root);
+			continue;
+		}
+		j = i;
+		while (j + 1 < count && recs[j + 1].key == recs[i].key)
+			j++;
+		if (node && node->n == recs[i].key)
+			node = tree_inorder_next(node, root);
+		if (recs[j].op == TREE_WAL_INSERT)
+			keys[size++] = recs[i].key;
+		i = j + 1;
+	}
+	return (size);
+}
+/**
+* tree_wal_replay - applies the log of a logged tree to its snapshot
+* @wal: pointer to the logged tree, holding the snapshot
+* Return: 0 on success, -1 on failure
+*
+* Description: rather than calling avl_insert and avl_remove once per
+* record, the records are sorted by value, merged with the snapshot in
+* order and the tree is rebuilt once with sorted_array_to_avl.
+*/
+int tree_wal_replay(tree_wal_t *wal)
+{
+	const binary_tree_t *node;
+	tree_wal_rec_t *recs;
+	size_t count, size = 0;
+	int *keys;
+
+	recs = tree_wal_read(wal, &count);
+	if (!recs || !count)
+	{
+		free(recs);
+		return (recs ? 0 : -1);
+	}
+	node = wal->root;
+	for (; node; node = tree_preorder_next(node, wal->root))
+		size++;
+	keys = malloc(sizeof(*keys) * (size + count));
+	if (keys)
+	{
+		qsort(recs, count, sizeof(*recs), tree_wal_cmp);
+		size = tree_wal_merge(wal->root, recs, count, keys);
+		binary_tree_delete(wal->root);
+		wal->root = size ? sorted_array_to_avl(keys, size) : NULL;
+	}
+	free(recs);
+	free(keys);
+	return (keys && (wal->root || !size) ? 0 : -1);
+}
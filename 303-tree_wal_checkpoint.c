@@ -0,0 +1,65 @@
+#include "binary_trees.h"
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+/**
+* tree_wal_sync_dir - makes the renaming of a file durable by syncing the
+* directory holding it
+* @path: path of the file
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_sync_dir(const char *path)
+{
+	char *dir = tree_wal_path(path, "");
+	char *slash;
+	int fd, ret = -1;
+
+	if (!dir)
+		return (-1);
+	slash = strrchr(dir, '/');
+	if (slash)
+		slash[slash == dir] = '\0';
+	fd = open(slash ? dir : ".", O_RDONLY);
+	if (fd != -1)
+	{
+		ret = fsync(fd);
+		close(fd);
+	}
+	free(dir);
+	return (ret);
+}
+/**
+* tree_wal_checkpoint - writes a snapshot of a logged tree and empties its
+* log
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure
+*
+* Description: the snapshot is written next to the previous one and renamed
+* over it, so a crash at any point leaves a snapshot and a log that
+* recover the same tree.
+*/
+int tree_wal_checkpoint(tree_wal_t *wal)
+{
+	char *tmp = tree_wal_path(wal->snap, ".tmp");
+	FILE *file = NULL;
+	int ret = -1;
+
+	if (tmp && tree_wal_commit(wal) == 0)
+		file = fopen(tmp, "wb");
+	if (file)
+	{
+		ret = binary_tree_save(file, wal->root, TREE_SERIAL_DELTA);
+		if (fflush(file) || fsync(fileno(file)) == -1)
+			ret = -1;
+		if (fclose(file))
+			ret = -1;
+		if (ret == 0)
+			ret = rename(tmp, wal->snap);
+		if (ret == 0)
+			ret = tree_wal_sync_dir(wal->snap);
+		if (ret == 0 && (ftruncate(wal->fd, 0) == -1 || fsync(wal->fd)))
+			ret = -1;
+	}
+	free(tmp);
+	return (ret);
+}
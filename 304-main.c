@@ -0,0 +1,93 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "binary_trees.h"
+
+/**
+ * report - prints one CSV line of the benchmark
+ * @op: name of the operation
+ * @batch: number of mutations per commit
+ * @start: clock value at the start of the run
+ * @ops: number of operations performed
+ */
+void report(const char *op, size_t batch, struct timespec *start,
+            size_t ops)
+{
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("%s,%lu,%lu,%.1f\n", op, (unsigned long)batch,
+           (unsigned long)ops, ((end.tv_sec - start->tv_sec) * 1e9 +
+                                (end.tv_nsec - start->tv_nsec)) / ops);
+}
+
+/**
+ * run - Logs a workload with a batch size, then recovers it from the log
+ * @keys: values inserted, then removed every third one
+ * @n: number of values
+ * @batch: number of mutations per commit
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int run(const int *keys, size_t n, size_t batch)
+{
+    struct timespec start;
+    tree_wal_t *wal;
+    avl_t *naive = NULL;
+    size_t i;
+
+    unlink("bench.log");
+    wal = tree_wal_open("bench", batch);
+    if (!wal)
+        return (1);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < n; i++)
+        tree_wal_insert(wal, keys[i]);
+    for (i = 0; i < n; i += 3)
+        tree_wal_remove(wal, keys[i]);
+    tree_wal_commit(wal);
+    report("mutate", batch, &start, n + (n + 2) / 3);
+    tree_wal_close(wal);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    wal = tree_wal_open("bench", batch);
+    report("replay", batch, &start, n + (n + 2) / 3);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < n; i++)
+        avl_insert(&naive, keys[i]);
+    for (i = 0; i < n; i += 3)
+        naive = avl_remove(naive, keys[i]);
+    report("replay_avl_insert", batch, &start, n + (n + 2) / 3);
+    binary_tree_delete(naive);
+    return (tree_wal_close(wal) ? 1 : 0);
+}
+
+/**
+ * main - Benchmarks group commit and log replay of a logged AVL tree
+ * @ac: argument count
+ * @av: av[1] is the optional number of values
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    size_t i, n = 5000, batches[] = {1, 16, 256, 4096};
+    int *keys;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    keys = malloc(sizeof(*keys) * n);
+    if (!keys || !n)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+        keys[i] = rand();
+    printf("op,batch,count,ns_per_op\n");
+    for (i = 0; i < 4; i++)
+        if (run(keys, n, batches[i]))
+            return (1);
+    unlink("bench.log");
+    unlink("bench.snap");
+    free(keys);
+    return (0);
+}
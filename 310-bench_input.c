@@ -0,0 +1,87 @@
+#include "binary_trees.h"
+#include <math.h>
+#include <string.h>
+/**
+* bench_random - draws a pseudo-random number with a xorshift generator
+* @state: state of the generator, not 0
+* Return: the number
+*/
+unsigned long bench_random(unsigned long *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return (*state);
+}
+/**
+* bench_cmp - orders two integers
+* @a: pointer to the first integer
+* @b: pointer to the second integer
+* Return: negative, zero or positive as a is lower, equal or greater
+*/
+int bench_cmp(const void *a, const void *b)
+{
+	int x = *(const int *)a, y = *(const int *)b;
+
+	return ((x > y) - (x < y));
+}
+/**
+* bench_zipf - draws the rank of a key from a Zipf distribution of
+* exponent BENCH_ZIPF_S by inverting its continuous approximation
+* @state: state of the generator
+* @n: number of ranks
+* Return: a rank between 1 and n, rank r being drawn about 1 / r^s as often
+* as rank 1
+*/
+size_t bench_zipf(unsigned long *state, size_t n)
+{
+	double e = 1 - BENCH_ZIPF_S, u, x;
+
+	u = (bench_random(state) >> 11) / 9007199254740992.0;
+	x = pow(u * (pow((double)n + 1, e) - 1) + 1, 1 / e);
+	return (x < 1 ? 1 : x > (double)n ? n : (size_t)x);
+}
+/**
+* bench_input - generates the keys of a benchmark
+* @b: pointer to the benchmark, whose size is set
+* @input: BENCH_SORTED, BENCH_RANDOM or BENCH_ZIPF
+* Return: 0 on success, -1 on failure
+*
+* Description: sorted and random inputs are the n distinct even numbers
+* below 2n, in order or shuffled; Zipf inputs repeat popular keys, spread
+* over the same range by an odd multiplier. sorted is set to the distinct
+* keys in order.
+*/
+int bench_input(tree_bench_t *b, int input)
+{
+	unsigned long state = 98;
+	size_t i, j;
+	int tmp;
+
+	b->keys = malloc(sizeof(int) * b->n);
+	b->sorted = malloc(sizeof(int) * b->n);
+	if (!b->keys || !b->sorted)
+		return (-1);
+	for (i = 0; i < b->n; i++)
+		b->keys[i] = (int)(i * 2);
+	for (i = 0; input == BENCH_ZIPF && i < b->n; i++)
+		b->keys[i] = (int)(bench_zipf(&state, b->n) * 2654435761UL %
+			(2 * b->n));
+	for (i = b->n - 1; input == BENCH_RANDOM && i > 0; i--)
+	{
+		j = bench_random(&state) % (i + 1);
+		tmp = b->keys[i];
+		b->keys[i] = b->keys[j];
+		b->keys[j] = tmp;
+	}
+	memcpy(b->sorted, b->keys, sizeof(int) * b->n);
+	if (input == BENCH_RANDOM)
+		for (i = 0; i < b->n; i++)
+			b->sorted[i] = (int)(i * 2);
+	if (input == BENCH_ZIPF)
+		qsort(b->sorted, b->n, sizeof(int), bench_cmp);
+	for (i = 0, b->unique = 0; i < b->n; i++)
+		if (!b->unique || b->sorted[i] != b->sorted[b->unique - 1])
+			b->sorted[b->unique++] = b->sorted[i];
+	return (0);
+}
@@ -0,0 +1,78 @@
+#include "binary_trees.h"
+/**
+* bench_insert - times avl_insert on every key of a benchmark
+* @b: pointer to the benchmark
+* Return: number of operations timed
+*/
+size_t bench_insert(tree_bench_t *b)
+{
+	avl_t *tree = NULL;
+	size_t i;
+
+	bench_start(b);
+	for (i = 0; i < b->n; i++)
+		avl_insert(&tree, b->keys[i]);
+	bench_stop(b);
+	binary_tree_delete(tree);
+	return (b->n);
+}
+/**
+* bench_search - times bst_search on every key of a benchmark, in an AVL
+* tree holding them all
+* @b: pointer to the benchmark
+* Return: number of operations timed
+*/
+size_t bench_search(tree_bench_t *b)
+{
+	avl_t *tree = sorted_array_to_avl(b->sorted, b->unique);
+	size_t i;
+
+	bench_start(b);
+	for (i = 0; i < b->n; i++)
+		b->sink += bst_search(tree, b->keys[i]) != NULL;
+	bench_stop(b);
+	binary_tree_delete(tree);
+	return (b->n);
+}
+/**
+* bench_remove - times avl_remove on every key of a benchmark, in an AVL
+* tree holding them all
+* @b: pointer to the benchmark
+* Return: number of operations timed
+*/
+size_t bench_remove(tree_bench_t *b)
+{
+	avl_t *tree = sorted_array_to_avl(b->sorted, b->unique);
+	size_t i;
+
+	bench_start(b);
+	for (i = 0; i < b->n; i++)
+		tree = avl_remove(tree, b->keys[i]);
+	bench_stop(b);
+	binary_tree_delete(tree);
+	return (b->n);
+}
+/**
+* bench_visit - visits a value during a timed traversal
+* @value: value visited, unused
+*/
+void bench_visit(int value)
+{
+	(void)value;
+}
+/**
+* bench_inorder - times binary_tree_inorder over an AVL tree holding the
+* keys of a benchmark
+* @b: pointer to the benchmark
+* Return: number of nodes visited
+*/
+size_t bench_inorder(tree_bench_t *b)
+{
+	avl_t *tree = sorted_array_to_avl(b->sorted, b->unique);
+
+	bench_start(b);
+	binary_tree_inorder(tree, bench_visit);
+	bench_stop(b);
+	binary_tree_delete(tree);
+	return (b->unique);
+}
@@ -0,0 +1,98 @@
+#include "binary_trees.h"
+/**
+* bench_is_bst - times binary_tree_is_bst on an AVL tree holding the keys
+* of a benchmark
+* @b: pointer to the benchmark
+* Return: number of nodes checked
+*/
+size_t bench_is_bst(tree_bench_t *b)
+{
+	avl_t *tree = sorted_array_to_avl(b->sorted, b->unique);
+
+	bench_start(b);
+	b->sink += binary_tree_is_bst(tree);
+	bench_stop(b);
+	binary_tree_delete(tree);
+	return (b->unique);
+}
+/**
+* bench_is_avl - times binary_tree_par_is_avl on an AVL tree holding the
+* keys of a benchmark
+* @b: pointer to the benchmark
+* Return: number of nodes checked
+*/
+size_t bench_is_avl(tree_bench_t *b)
+{
+	avl_t *tree = sorted_array_to_avl(b->sorted, b->unique);
+
+	bench_start(b);
+	b->sink += binary_tree_par_is_avl(tree);
+	bench_stop(b);
+	binary_tree_delete(tree);
+	return (b->unique);
+}
+/**
+* bench_heap_build - times array_to_heap on the keys of a benchmark
+* @b: pointer to the benchmark
+* Return: number of keys inserted
+*/
+size_t bench_heap_build(tree_bench_t *b)
+{
+	heap_t *heap;
+
+	bench_start(b);
+	heap = array_to_heap(b->keys, b->n);
+	bench_stop(b);
+	b->sink += binary_tree_par_is_heap(heap);
+	binary_tree_delete(heap);
+	return (b->n);
+}
+/**
+* bench_heap_extract - times heap_extract until a heap built from the keys
+* of a benchmark is empty
+* @b: pointer to the benchmark
+* Return: number of keys extracted
+*/
+size_t bench_heap_extract(tree_bench_t *b)
+{
+	heap_t *heap = array_to_heap(b->keys, b->n);
+	size_t count = 0;
+
+	bench_start(b);
+	for (; heap; count++)
+		b->sink += (size_t)heap_extract(&heap);
+	bench_stop(b);
+	return (count);
+}
+/**
+* bench_lca - times binary_trees_ancestor on random pairs of nodes of an
+* AVL tree holding the keys of a benchmark
+* @b: pointer to the benchmark
+* Return: number of pairs looked up
+*/
+size_t bench_lca(tree_bench_t *b)
+{
+	avl_t *tree = sorted_array_to_avl(b->sorted, b->unique);
+	const binary_tree_t **nodes = malloc(sizeof(*nodes) * b->unique);
+	const binary_tree_t *node;
+	size_t i = 0, count = b->unique < BENCH_PAIRS ? b->unique : BENCH_PAIRS;
+	size_t *pairs = malloc(sizeof(*pairs) * count * 2);
+	unsigned long state = 402;
+
+	if (!tree || !nodes || !pairs)
+		count = 0;
+	node = tree ? tree_inorder_first(tree) : NULL;
+	for (; count && node; node = tree_inorder_next(node, tree))
+		nodes[i++] = node;
+	for (i = 0; i < count * 2; i++)
+		pairs[i] = bench_random(&state) % b->unique;
+	bench_start(b);
+	for (i = 0; i < count; i++)
+		b->sink += binary_trees_ancestor(nodes[pairs[i * 2]],
+			nodes[pairs[i * 2 + 1]]) != NULL;
+	bench_stop(b);
+	free(pairs);
+	free(nodes);
+	binary_tree_delete(tree);
+	return (count);
+}
@@ -0,0 +1,136 @@
+#include "binary_trees.h"
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+/**
+* bench_start - starts the timer of a benchmark
+* @b: pointer to the benchmark
+*/
+void bench_start(tree_bench_t *b)
+{
+#ifdef TREE_COUNTERS
+	tree_counters_start(&b->counters);
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &b->start);
+}
+/**
+* bench_stop - stops the timer of a benchmark, adding the time elapsed
+* @b: pointer to the benchmark
+*/
+void bench_stop(tree_bench_t *b)
+{
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	b->ns += (end.tv_sec - b->start.tv_sec) * 1e9 +
+		(end.tv_nsec - b->start.tv_nsec);
+#ifdef TREE_COUNTERS
+	tree_counters_stop(&b->counters);
+#endif
+}
+/**
+* bench_report - prints the result of a benchmark as CSV or JSON
+* @op: operation benchmarked
+* @input: BENCH_SORTED, BENCH_RANDOM or BENCH_ZIPF
+* @b: pointer to the benchmark
+* @ops: number of operations timed
+* @format: BENCH_CSV, BENCH_JSON, or BENCH_JSON_NEXT after the first row
+*/
+void bench_report(const tree_bench_op_t *op, int input, const tree_bench_t *b,
+	size_t ops, int format)
+{
+	const char *inputs[] = {"sorted", "random", "zipf"};
+	struct rusage usage;
+	double ns = ops ? b->ns / ops : 0;
+
+	getrusage(RUSAGE_SELF, &usage);
+	if (format == BENCH_CSV)
+		printf("%s,%s,%lu,%lu,%.1f,%.0f,%ld", op->name, inputs[input],
+			(unsigned long)b->n, (unsigned long)ops, ns,
+			ns ? 1e9 / ns : 0, usage.ru_maxrss);
+	else
+		printf("%s{\"op\": \"%s\", \"input\": \"%s\", "
+			"\"size\": %lu, \"ops\": %lu, \"ns_per_op\": %.1f, "
+			"\"ops_per_sec\": %.0f, \"peak_rss_kb\": %ld",
+			format == BENCH_JSON ? "" : ",\n", op->name,
+			inputs[input], (unsigned long)b->n, (unsigned long)ops,
+			ns, ns ? 1e9 / ns : 0, usage.ru_maxrss);
+#ifdef TREE_COUNTERS
+	bench_report_counters(b, ops, format);
+#endif
+	printf(format == BENCH_CSV ? "\n" : "}");
+}
+#ifdef TREE_COUNTERS
+/**
+* bench_report_counters - prints the hardware counters of a benchmark per
+* operation, -1 for the events perf_event_open cannot count
+* Description: the counter source is perf_main_thread when the events
+* could not be inherited, the counts then leaving out worker threads.
+* @b: pointer to the benchmark
+* @ops: number of operations timed
+* @format: BENCH_CSV, BENCH_JSON or BENCH_JSON_NEXT
+*/
+void bench_report_counters(const tree_bench_t *b, size_t ops, int format)
+{
+	const char *names[] = {"cycles", "instructions", "cache_misses",
+		"branch_misses"};
+	const tree_counters_t *c = &b->counters;
+	double value;
+	int i;
+
+	for (i = 0; i < TREE_COUNTER_COUNT; i++)
+	{
+		value = ops ? (double)c->total[i] / ops : 0;
+		if (c->fd[i] == -1 && i != TREE_COUNTER_CYCLES)
+			value = -1;
+		if (format == BENCH_CSV)
+			printf(",%.1f", value);
+		else
+			printf(", \"%s_per_op\": %.1f", names[i], value);
+	}
+	printf(format == BENCH_CSV ? ",%s" : ", \"counter_source\": \"%s\"",
+		!c->perf ? "tsc" : c->inherit ? "perf" : "perf_main_thread");
+}
+#endif
+/**
+* bench_run - runs a benchmark in a child process, so that its peak
+* resident set size is its own
+* @op: operation to benchmark
+* @input: BENCH_SORTED, BENCH_RANDOM or BENCH_ZIPF
+* @n: number of keys
+* @format: BENCH_CSV, BENCH_JSON, or BENCH_JSON_NEXT after the first row
+* Return: 0 on success, -1 on failure
+*/
+int bench_run(const tree_bench_op_t *op, int input, size_t n, int format)
+{
+	tree_bench_t b;
+	size_t ops;
+	pid_t pid;
+	int status;
+
+	fflush(stdout);
+	pid = fork();
+	if (pid == -1)
+		return (-1);
+	if (!pid)
+	{
+		memset(&b, 0, sizeof(b));
+		b.n = n;
+		if (bench_input(&b, input) == -1)
+			_exit(1);
+#ifdef TREE_COUNTERS
+		tree_counters_open(&b.counters);
+#endif
+		ops = op->run(&b);
+		bench_report(op, input, &b, ops, format);
+#ifdef TREE_COUNTERS
+		tree_counters_close(&b.counters);
+#endif
+		fflush(stdout);
+		_exit(0);
+	}
+	if (waitpid(pid, &status, 0) == -1)
+		return (-1);
+	return (WIFEXITED(status) && !WEXITSTATUS(status) ? 0 : -1);
+}
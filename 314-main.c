@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "binary_trees.h"
+
+/**
+ * main - Benchmarks every tree operation over sorted, random and Zipf
+ * inputs of 1e3 keys up to a maximum size
+ * @ac: argument count
+ * @av: av[1] is the optional maximum size, 1e6 by default and at most 1e8,
+ * av[2] is "json" to print JSON instead of CSV
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    tree_bench_op_t ops[] = {
+        {"avl_insert", bench_insert, 10000},
+        {"bst_search", bench_search, 0},
+        {"avl_remove", bench_remove, 10000},
+        {"inorder", bench_inorder, 0},
+        {"is_bst", bench_is_bst, 0},
+        {"par_is_avl", bench_is_avl, 0},
+        {"heap_build", bench_heap_build, 10000},
+        {"heap_extract", bench_heap_extract, 10000},
+        {"ancestor", bench_lca, 0}
+    };
+    size_t i, n, max = 1000000;
+    int input, format = BENCH_CSV, failed = 0;
+
+    if (ac > 1)
+        max = strtoul(av[1], NULL, 10);
+    if (ac > 2 && !strcmp(av[2], "json"))
+        format = BENCH_JSON;
+    if (max > 100000000)
+        max = 100000000;
+    if (format == BENCH_CSV)
+        printf(BENCH_CSV_HEADER);
+    else
+        printf("[\n");
+    for (n = 1000; n <= max; n *= 10)
+        for (i = 0; i < sizeof(ops) / sizeof(ops[0]); i++)
+            for (input = BENCH_SORTED; input <= BENCH_ZIPF; input++)
+            {
+                if (ops[i].max_size && n > ops[i].max_size)
+                    continue;
+                if (bench_run(&ops[i], input, n, format) == -1)
+                    failed = 1;
+                else if (format == BENCH_JSON)
+                    format = BENCH_JSON_NEXT;
+            }
+    if (format != BENCH_CSV)
+        printf("\n]\n");
+    return (failed);
+}
@@ -0,0 +1,121 @@
+#include "binary_trees.h"
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+/**
+* tree_counters_tsc - reads the time-stamp counter, or a nanosecond clock
+* where there is none
+* Return: the counter
+*/
+unsigned long tree_counters_tsc(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return ((unsigned long)__builtin_ia32_rdtsc());
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((unsigned long)now.tv_sec * 1000000000UL + now.tv_nsec);
+#endif
+}
+/**
+* tree_counters_open - opens the hardware counters of the calling thread
+* and of the threads it creates afterwards
+* @c: counters to open
+* Return: 1 if perf_event_open gave the cycle counter, 0 if cycles fall
+* back to the time-stamp counter and the other events are unavailable
+*
+* Description: the counts of an inherited thread reach the totals once it
+* exits, so workers must be joined before tree_counters_stop. An event
+* that cannot be inherited is opened for the calling thread alone, and
+* inherit is cleared.
+*/
+int tree_counters_open(tree_counters_t *c)
+{
+	const unsigned long events[] = {PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_BRANCH_MISSES};
+	struct perf_event_attr attr;
+	int i;
+
+	memset(c, 0, sizeof(*c));
+	c->inherit = 1;
+	for (i = 0; i < TREE_COUNTER_COUNT; i++)
+	{
+		memset(&attr, 0, sizeof(attr));
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.size = sizeof(attr);
+		attr.config = events[i];
+		attr.disabled = 1;
+		attr.inherit = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		c->fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1,
+			0);
+		if (c->fd[i] != -1)
+			continue;
+		attr.inherit = 0;
+		c->fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1,
+			0);
+		if (c->fd[i] != -1)
+			c->inherit = 0;
+	}
+	c->perf = c->fd[TREE_COUNTER_CYCLES] != -1;
+	return (c->perf);
+}
+/**
+* tree_counters_start - starts counting
+* @c: counters opened by tree_counters_open
+*/
+void tree_counters_start(tree_counters_t *c)
+{
+	int i;
+
+	for (i = 0; i < TREE_COUNTER_COUNT; i++)
+		if (c->fd[i] != -1)
+		{
+			ioctl(c->fd[i], PERF_EVENT_IOC_RESET, 0);
+			ioctl(c->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+		}
+	if (!c->perf)
+		c->tsc = tree_counters_tsc();
+}
+/**
+* tree_counters_stop - stops counting, adding the counts to the totals
+* @c: counters started by tree_counters_start
+*/
+void tree_counters_stop(tree_counters_t *c)
+{
+	unsigned long value;
+	int i;
+
+	if (!c->perf)
+	{
+		value = tree_counters_tsc() - c->tsc;
+		c->total[TREE_COUNTER_CYCLES] += value;
+	}
+	for (i = 0; i < TREE_COUNTER_COUNT; i++)
+	{
+		if (c->fd[i] == -1)
+			continue;
+		ioctl(c->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+		if (read(c->fd[i], &value, sizeof(value)) == sizeof(value))
+			c->total[i] += value;
+	}
+}
+/**
+* tree_counters_close - closes the hardware counters
+* @c: counters opened by tree_counters_open
+*/
+void tree_counters_close(tree_counters_t *c)
+{
+	int i;
+
+	for (i = 0; i < TREE_COUNTER_COUNT; i++)
+		if (c->fd[i] != -1)
+			close(c->fd[i]);
+	for (i = 0; i < TREE_COUNTER_COUNT; i++)
+		c->fd[i] = -1;
+}
@@ -0,0 +1,92 @@
+#include "binary_trees.h"
+
+__thread tree_stats_t *tree_stats_local;
+static tree_stats_t *tree_stats_shards;
+static pthread_mutex_t tree_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+* tree_stats_shard - gives the counters of the calling thread, creating and
+* registering them on first use
+* Description: Each thread only writes its own counters, on their own cache
+* line, so counting takes no lock. The counters outlive the thread so that
+* its counts stay in the sums. Should allocating them fail, the thread
+* counts into shared counters left out of the sums.
+* Return: pointer to the counters of the thread
+*/
+tree_stats_t *tree_stats_shard(void)
+{
+	static tree_stats_t shared;
+	void *mem;
+
+	if (tree_stats_local)
+		return (tree_stats_local);
+	if (posix_memalign(&mem, 64, sizeof(tree_stats_t) < 64 ? 64 :
+		sizeof(tree_stats_t)))
+	{
+		tree_stats_local = &shared;
+		return (tree_stats_local);
+	}
+	tree_stats_local = mem;
+	tree_stats_local->comparisons = 0;
+	tree_stats_local->rotations = 0;
+	tree_stats_local->allocations = 0;
+	tree_stats_local->frees = 0;
+	tree_stats_local->max_depth = 0;
+	tree_stats_local->rebalances = 0;
+	pthread_mutex_lock(&tree_stats_lock);
+	tree_stats_local->next = tree_stats_shards;
+	tree_stats_shards = tree_stats_local;
+	pthread_mutex_unlock(&tree_stats_lock);
+	return (tree_stats_local);
+}
+/**
+* tree_stats_depth - records the depth of a node about to be allocated
+* @parent: parent of the node, NULL for a root
+*/
+void tree_stats_depth(const binary_tree_t *parent)
+{
+	tree_stats_t *stats = tree_stats_shard();
+	unsigned long depth = 0;
+
+	for (; parent; parent = parent->parent)
+		depth++;
+	if (depth > stats->max_depth)
+		__atomic_store_n(&stats->max_depth, depth, __ATOMIC_RELAXED);
+}
+/**
+* tree_stats_snapshot - sums the counters of every thread
+* Description: Counters are read while their threads keep counting, so the
+* sums are each exact but not taken at a single instant. Subtracting two
+* snapshots gives the counts of the operations made in between.
+* @stats: filled with the sums, and the deepest level seen by any thread
+*/
+void tree_stats_snapshot(tree_stats_t *stats)
+{
+	tree_stats_t *s;
+	unsigned long depth;
+
+	stats->comparisons = 0;
+	stats->rotations = 0;
+	stats->allocations = 0;
+	stats->frees = 0;
+	stats->max_depth = 0;
+	stats->rebalances = 0;
+	stats->next = NULL;
+	pthread_mutex_lock(&tree_stats_lock);
+	for (s = tree_stats_shards; s; s = s->next)
+	{
+		stats->comparisons += __atomic_load_n(&s->comparisons,
+			__ATOMIC_RELAXED);
+		stats->rotations += __atomic_load_n(&s->rotations,
+			__ATOMIC_RELAXED);
+		stats->allocations += __atomic_load_n(&s->allocations,
+			__ATOMIC_RELAXED);
+		stats->frees += __atomic_load_n(&s->frees, __ATOMIC_RELAXED);
+		stats->rebalances += __atomic_load_n(&s->rebalances,
+			__ATOMIC_RELAXED);
+		depth = __atomic_load_n(&s->max_depth, __ATOMIC_RELAXED);
+		if (depth > stats->max_depth)
+			stats->max_depth = depth;
+	}
+	pthread_mutex_unlock(&tree_stats_lock);
+}
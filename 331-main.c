@@ -0,0 +1,80 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "binary_trees.h"
+
+#define THREADS 4
+#define VALUES 1000
+
+/**
+ * print_stats - Prints the counts made between two snapshots
+ *
+ * @title: Title of the counts
+ * @before: Snapshot taken before the operations
+ * @after: Snapshot taken after the operations
+ */
+void print_stats(const char *title, const tree_stats_t *before,
+                 const tree_stats_t *after)
+{
+    printf("%s:\n", title);
+    printf("  comparisons: %lu\n", after->comparisons - before->comparisons);
+    printf("  rotations: %lu\n", after->rotations - before->rotations);
+    printf("  allocations: %lu\n", after->allocations - before->allocations);
+    printf("  frees: %lu\n", after->frees - before->frees);
+    printf("  rebalances: %lu\n", after->rebalances - before->rebalances);
+    printf("  max depth: %lu\n", after->max_depth);
+}
+
+/**
+ * worker - Builds an AVL tree, then removes half of it and deletes it
+ *
+ * @arg: Seed of the values inserted
+ *
+ * Return: NULL
+ */
+void *worker(void *arg)
+{
+    unsigned int seed = (unsigned int)(size_t)arg;
+    int values[VALUES];
+    avl_t *tree = NULL;
+    size_t i;
+
+    for (i = 0; i < VALUES; i++)
+    {
+        values[i] = rand_r(&seed) % 100000;
+        avl_insert(&tree, values[i]);
+    }
+    for (i = 0; i < VALUES; i += 2)
+        tree = avl_remove(tree, values[i]);
+    binary_tree_delete(tree);
+    return (NULL);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    tree_stats_t before, after;
+    pthread_t threads[THREADS];
+    avl_t *tree = NULL;
+    size_t i;
+
+    tree_stats_snapshot(&before);
+    for (i = 1; i <= 127; i++)
+        avl_insert(&tree, (int)i);
+    tree_stats_snapshot(&after);
+    print_stats("127 sorted insertions", &before, &after);
+    before = after;
+    for (i = 0; i < THREADS; i++)
+        if (pthread_create(&threads[i], NULL, worker, (void *)(i + 1)))
+            return (1);
+    for (i = 0; i < THREADS; i++)
+        pthread_join(threads[i], NULL);
+    tree_stats_snapshot(&after);
+    print_stats("4 threads", &before, &after);
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,90 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "tree_template.h"
+
+/**
+ * struct name_s - Fixed-width byte string key
+ *
+ * @b: Bytes of the key, padded with 0
+ */
+typedef struct name_s
+{
+    char b[16];
+} name_t;
+
+#define NAME_CMP(x, y) memcmp((x).b, (y).b, sizeof((x).b))
+
+TREE_DEFINE(big, int64_t, char, TREE_CMP)
+TREE_DEFINE(price, double, int, TREE_CMP)
+TREE_DEFINE(word, name_t, size_t, NAME_CMP)
+
+/**
+ * name - Makes a key from a string
+ *
+ * @s: String, truncated to 16 bytes
+ *
+ * Return: The key
+ */
+name_t name(const char *s)
+{
+    name_t key;
+    size_t len = strlen(s);
+
+    memset(&key, 0, sizeof(key));
+    memcpy(key.b, s, len < sizeof(key.b) ? len : sizeof(key.b));
+    return (key);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    big_t *bigs = NULL;
+    price_t *prices = NULL;
+    word_t *words = NULL, *w;
+    const char *text[] = {"oak", "elm", "ash", "oak", "fir", "elm", "oak"};
+    double p;
+    int item;
+    size_t i, size = 0;
+
+    for (i = 0; i < 40; i++)
+        big_avl_insert(&bigs, (int64_t)i << 33, 0);
+    printf("int64_t AVL: height %d, root %ld, 2^35 %sfound\n",
+           big_height(bigs), (long)bigs->key,
+           big_bst_search(bigs, (int64_t)1 << 35) ? "" : "not ");
+    bigs = big_avl_remove(bigs, (int64_t)1 << 35);
+    printf("After removal: 2^35 %sfound\n",
+           big_bst_search(bigs, (int64_t)1 << 35) ? "" : "not ");
+    big_delete(bigs);
+
+    price_heap_insert(&prices, &size, 9.99, 1);
+    price_heap_insert(&prices, &size, 24.5, 2);
+    price_heap_insert(&prices, &size, 0.75, 3);
+    price_heap_insert(&prices, &size, 12.0, 4);
+    printf("double heap:");
+    while (price_heap_extract(&prices, &size, &p, &item))
+        printf(" %.2f (item %d)", p, item);
+    printf("\n");
+
+    for (i = 0; i < sizeof(text) / sizeof(*text); i++)
+    {
+        w = word_bst_search(words, name(text[i]));
+        if (w)
+            w->value++;
+        else
+            word_bst_insert(&words, name(text[i]), 1);
+    }
+    words = word_bst_remove(words, name("fir"));
+    printf("16-byte keys: oak %lu, elm %lu, ash %lu, fir %s\n",
+           (unsigned long)word_bst_search(words, name("oak"))->value,
+           (unsigned long)word_bst_search(words, name("elm"))->value,
+           (unsigned long)word_bst_search(words, name("ash"))->value,
+           word_bst_search(words, name("fir")) ? "found" : "removed");
+    word_delete(words);
+    return (0);
+}
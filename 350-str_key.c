@@ -0,0 +1,71 @@
+#include <string.h>
+#include "binary_trees.h"
+/**
+* str_prefix - packs the first bytes of a key into an integer
+* @key: NUL-terminated key
+* @len: set to the length of the key
+* Return: the first STR_PREFIX bytes, big-endian and padded with 0
+*/
+uint64_t str_prefix(const char *key, size_t *len)
+{
+	uint64_t prefix = 0;
+	size_t i;
+
+	*len = strlen(key);
+	for (i = 0; i < STR_PREFIX; i++)
+		prefix = prefix << 8 | (i < *len ? (unsigned char)key[i] : 0);
+	return (prefix);
+}
+/**
+* str_key_cmp - compares a key with the key of a node
+* Description: Keys holding no NUL byte, equal prefixes of a key shorter
+* than STR_PREFIX mean equal keys, so most comparisons end with the
+* integer one and only long keys sharing a prefix reach strcmp.
+* @prefix: prefix of the key, from str_prefix
+* @key: the key
+* @len: length of the key
+* @node: pointer to the node
+* Return: negative, 0 or positive as the key sorts before, equal to or after
+* the key of the node
+*/
+int str_key_cmp(uint64_t prefix, const char *key, size_t len,
+	const str_node_t *node)
+{
+	if (prefix != node->prefix)
+		return (prefix < node->prefix ? -1 : 1);
+	if (len < STR_PREFIX)
+		return (0);
+	return (strcmp(key + STR_PREFIX, node->key + STR_PREFIX));
+}
+/**
+* str_arena_copy - copies a key into the arena of a tree
+* Description: Keys are packed into chunks of STR_ARENA_CHUNK bytes, or a
+* chunk of their own when longer, which are only freed with the tree.
+* @tree: pointer to the tree
+* @key: key to copy
+* @len: length of the key
+* Return: pointer to the copy, or NULL on failure
+*/
+char *str_arena_copy(str_bst_t *tree, const char *key, size_t len)
+{
+	str_arena_t *arena = tree->arena;
+	size_t size;
+	char *copy;
+
+	if (!arena || arena->size - arena->used <= len)
+	{
+		size = len >= STR_ARENA_CHUNK ? len + 1 : STR_ARENA_CHUNK;
+		arena = malloc(sizeof(str_arena_t) + size);
+		if (!arena)
+			return (NULL);
+		arena->data = (char *)(arena + 1);
+		arena->used = 0;
+		arena->size = size;
+		arena->next = tree->arena;
+		tree->arena = arena;
+	}
+	copy = arena->data + arena->used;
+	memcpy(copy, key, len + 1);
+	arena->used += len + 1;
+	return (copy);
+}
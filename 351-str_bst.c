@@ -0,0 +1,133 @@
+#include "binary_trees.h"
+/**
+* str_bst_search - searches for a key in a string-keyed tree
+* @tree: pointer to the tree
+* @key: key to search for
+* Return: pointer to the node holding the key, or NULL
+*/
+str_node_t *str_bst_search(const str_bst_t *tree, const char *key)
+{
+	str_node_t *node = tree->root;
+	uint64_t prefix;
+	size_t len;
+	int c;
+
+	prefix = str_prefix(key, &len);
+	while (node)
+	{
+		c = str_key_cmp(prefix, key, len, node);
+		if (c == 0)
+			return (node);
+		node = c < 0 ? node->left : node->right;
+	}
+	return (NULL);
+}
+/**
+* str_bst_insert - inserts a key in a string-keyed tree
+* @tree: pointer to the tree
+* @key: key to insert, copied into the arena of the tree
+* Return: pointer to the created node, or NULL on failure or if the key is
+* already in the tree
+*/
+str_node_t *str_bst_insert(str_bst_t *tree, const char *key)
+{
+	str_node_t *parent = NULL, **link = &tree->root, *node;
+	uint64_t prefix;
+	size_t len;
+	int c;
+
+	prefix = str_prefix(key, &len);
+	while (*link)
+	{
+		parent = *link;
+		c = str_key_cmp(prefix, key, len, parent);
+		if (c == 0)
+			return (NULL);
+		link = c < 0 ? &parent->left : &parent->right;
+	}
+	node = malloc(sizeof(str_node_t));
+	if (!node)
+		return (NULL);
+	node->key = str_arena_copy(tree, key, len);
+	if (!node->key)
+	{
+		free(node);
+		return (NULL);
+	}
+	node->prefix = prefix;
+	node->len = len;
+	node->parent = parent;
+	node->left = NULL;
+	node->right = NULL;
+	tree->size++;
+	return (*link = node);
+}
+/**
+* str_bst_remove - removes a key from a string-keyed tree
+* Description: As in bst_remove, a node with two children takes the key of
+* its successor. The bytes of the removed key stay in the arena.
+* @tree: pointer to the tree
+* @key: key to remove
+* Return: pointer to the new root node of the tree
+*/
+str_node_t *str_bst_remove(str_bst_t *tree, const char *key)
+{
+	str_node_t *node = str_bst_search(tree, key), *next, *child;
+
+	if (!node)
+		return (tree->root);
+	if (node->left && node->right)
+	{
+		for (next = node->right; next->left; next = next->left)
+			;
+		node->prefix = next->prefix;
+		node->len = next->len;
+		node->key = next->key;
+		node = next;
+	}
+	child = node->left ? node->left : node->right;
+	if (child)
+		child->parent = node->parent;
+	if (!node->parent)
+		tree->root = child;
+	else if (node->parent->left == node)
+		node->parent->left = child;
+	else
+		node->parent->right = child;
+	free(node);
+	tree->size--;
+	return (tree->root);
+}
+/**
+* str_bst_delete - frees the nodes and keys of a string-keyed tree
+* @tree: pointer to the tree, left empty
+*/
+void str_bst_delete(str_bst_t *tree)
+{
+	str_node_t *node = tree->root, *next;
+	str_arena_t *arena;
+
+	while (node)
+	{
+		if (node->left)
+		{
+			next = node->left;
+			node->left = next->right;
+			next->right = node;
+		}
+		else
+		{
+			next = node->right;
+			free(node);
+		}
+		node = next;
+	}
+	while (tree->arena)
+	{
+		arena = tree->arena;
+		tree->arena = arena->next;
+		free(arena);
+	}
+	tree->root = NULL;
+	tree->size = 0;
+}
@@ -0,0 +1,125 @@
+#include <string.h>
+#include "binary_trees.h"
+/**
+* str_frozen_put - appends bytes to the data of a frozen form, growing it
+* @frozen: pointer to the frozen form
+* @cap: capacity of the data, updated when it grows
+* @bytes: bytes to append
+* @len: number of bytes
+* Return: 0 on success, -1 on failure
+*/
+static int str_frozen_put(str_frozen_t *frozen, size_t *cap,
+	const void *bytes, size_t len)
+{
+	unsigned char *data;
+
+	if (frozen->size + len > *cap)
+	{
+		*cap = (frozen->size + len) * 2;
+		data = realloc(frozen->data, *cap);
+		if (!data)
+			return (-1);
+		frozen->data = data;
+	}
+	memcpy(frozen->data + frozen->size, bytes, len);
+	frozen->size += len;
+	return (0);
+}
+/**
+* str_frozen_varint - appends a varint to the data of a frozen form
+* @frozen: pointer to the frozen form
+* @cap: capacity of the data, updated when it grows
+* @value: integer to append, seven bits per byte as in tree_write_varint
+* Return: 0 on success, -1 on failure
+*/
+static int str_frozen_varint(str_frozen_t *frozen, size_t *cap,
+	unsigned long value)
+{
+	unsigned char buf[16];
+	size_t len = 0;
+
+	while (value >= 0x80)
+	{
+		buf[len++] = (unsigned char)(value & 0x7f) | 0x80;
+		value >>= 7;
+	}
+	buf[len++] = (unsigned char)value;
+	return (str_frozen_put(frozen, cap, buf, len));
+}
+/**
+* str_frozen_next - gives the in-order successor of a node
+* @node: pointer to the node, NULL for the first node of the tree
+* @root: pointer to the root node of the tree
+* Return: pointer to the successor, or NULL after the last node
+*/
+static const str_node_t *str_frozen_next(const str_node_t *node,
+	const str_node_t *root)
+{
+	if (!node || node->right)
+	{
+		node = node ? node->right : root;
+		while (node && node->left)
+			node = node->left;
+		return (node);
+	}
+	while (node->parent && node->parent->right == node)
+		node = node->parent;
+	return (node->parent);
+}
+/**
+* str_bst_freeze - builds the sorted front-coded form of a string-keyed tree
+* Description: Each key is stored as the length it shares with the previous
+* key and the bytes after, except every interval-th key, stored whole so
+* that searches can start from it.
+* @tree: pointer to the tree
+* @interval: keys from one restart to the next, 1 to store every key whole
+* @frozen: filled with the frozen form, to free with str_frozen_free
+* Return: 0 on success, -1 on failure
+*/
+int str_bst_freeze(const str_bst_t *tree, size_t interval,
+	str_frozen_t *frozen)
+{
+	const str_node_t *node, *prev = NULL;
+	size_t cap = 0, shared, rest;
+
+	memset(frozen, 0, sizeof(*frozen));
+	frozen->interval = interval ? interval : 1;
+	frozen->blocks = (tree->size + frozen->interval - 1) / frozen->interval;
+	frozen->restarts = malloc(sizeof(size_t) * (frozen->blocks + 1));
+	if (!frozen->restarts)
+		return (-1);
+	for (node = str_frozen_next(NULL, tree->root); node;
+		prev = node, node = str_frozen_next(node, tree->root))
+	{
+		shared = 0;
+		if (frozen->count % frozen->interval == 0)
+			frozen->restarts[frozen->count / frozen->interval] =
+				frozen->size;
+		else
+			while (shared < node->len &&
+				prev->key[shared] == node->key[shared])
+				shared++;
+		rest = node->len - shared;
+		if (str_frozen_varint(frozen, &cap, shared) ||
+			str_frozen_varint(frozen, &cap, rest) ||
+			str_frozen_put(frozen, &cap, node->key + shared, rest))
+		{
+			str_frozen_free(frozen);
+			return (-1);
+		}
+		frozen->max_len = node->len > frozen->max_len ? node->len :
+			frozen->max_len;
+		frozen->count++;
+	}
+	return (0);
+}
+/**
+* str_frozen_free - frees the frozen form of a tree
+* @frozen: frozen form built by str_bst_freeze
+*/
+void str_frozen_free(str_frozen_t *frozen)
+{
+	free(frozen->data);
+	free(frozen->restarts);
+	memset(frozen, 0, sizeof(*frozen));
+}
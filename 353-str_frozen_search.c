@@ -0,0 +1,140 @@
+#include <string.h>
+#include "binary_trees.h"
+/**
+* str_frozen_get - reads a varint from the data of a frozen form
+* @data: the data
+* @pos: offset of the varint, moved past it
+* Return: the integer
+*/
+static size_t str_frozen_get(const unsigned char *data, size_t *pos)
+{
+	size_t value = 0;
+	unsigned int shift = 0;
+
+	while (data[*pos] & 0x80)
+	{
+		value |= (size_t)(data[(*pos)++] & 0x7f) << shift;
+		shift += 7;
+	}
+	return (value | (size_t)data[(*pos)++] << shift);
+}
+/**
+* str_frozen_cmp - compares a key with bytes of a stored key
+* @key: the key
+* @klen: length of the key
+* @s: the stored bytes
+* @len: number of stored bytes
+* @common: set to the length of the prefix they share
+* Return: negative, 0 or positive as the key sorts before, equal to or after
+* the stored bytes
+*/
+static int str_frozen_cmp(const char *key, size_t klen,
+	const unsigned char *s, size_t len, size_t *common)
+{
+	size_t c = 0;
+
+	while (c < klen && c < len && (unsigned char)key[c] == s[c])
+		c++;
+	*common = c;
+	if (c == klen || c == len)
+		return (klen == len ? 0 : (c == klen ? -1 : 1));
+	return ((unsigned char)key[c] < s[c] ? -1 : 1);
+}
+/**
+* str_frozen_scan - searches for a key in a block of a frozen form
+* Description: @m is the length the key shares with the last key read,
+* which sorts before it. A key sharing more than @m bytes with that one
+* sorts before the searched key too, and a key sharing fewer sorts after,
+* so only keys sharing exactly @m bytes are compared, from byte @m on.
+* @frozen: pointer to the frozen form
+* @block: block whose first key sorts before or equal to the key
+* @key: the key
+* @klen: length of the key
+* @rank: set to the number of smaller keys when the key is found
+* Return: 1 if the key is found, 0 otherwise
+*/
+static int str_frozen_scan(const str_frozen_t *frozen, size_t block,
+	const char *key, size_t klen, size_t *rank)
+{
+	size_t i = block * frozen->interval, pos = frozen->restarts[block];
+	size_t m = 0, shared, len, c;
+	int cmp;
+
+	for (; i < frozen->count && i < (block + 1) * frozen->interval; i++)
+	{
+		shared = str_frozen_get(frozen->data, &pos);
+		len = str_frozen_get(frozen->data, &pos);
+		if (shared < m)
+			return (0);
+		cmp = shared > m ? 1 : str_frozen_cmp(key + m, klen - m,
+			frozen->data + pos, len, &c);
+		pos += len;
+		if (cmp == 0)
+		{
+			*rank = i;
+			return (1);
+		}
+		if (cmp < 0)
+			return (0);
+		m += shared > m ? 0 : c;
+	}
+	return (0);
+}
+/**
+* str_frozen_search - searches for a key in the frozen form of a tree
+* Description: A binary search over the keys stored whole at restarts
+* finds the block, which is then scanned without rebuilding its keys.
+* @frozen: pointer to the frozen form
+* @key: key to search for
+* @rank: set to the number of smaller keys when the key is found, may be NULL
+* Return: 1 if the key is found, 0 otherwise
+*/
+int str_frozen_search(const str_frozen_t *frozen, const char *key,
+	size_t *rank)
+{
+	size_t klen = strlen(key), lo = 0, hi = frozen->blocks, mid, pos, len;
+	size_t c, found;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		pos = frozen->restarts[mid];
+		str_frozen_get(frozen->data, &pos);
+		len = str_frozen_get(frozen->data, &pos);
+		if (str_frozen_cmp(key, klen, frozen->data + pos, len, &c) < 0)
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+	if (lo == 0 || !str_frozen_scan(frozen, lo - 1, key, klen, &found))
+		return (0);
+	if (rank)
+		*rank = found;
+	return (1);
+}
+/**
+* str_frozen_walk - goes through the keys of a frozen form, in order
+* @frozen: pointer to the frozen form
+* @func: pointer to a function to call for each key
+* Return: number of keys gone through, 0 on failure
+*/
+size_t str_frozen_walk(const str_frozen_t *frozen, void (*func)(const char *))
+{
+	size_t pos = 0, count = 0, shared, len;
+	char *key;
+
+	key = malloc(frozen->max_len + 1);
+	if (!key)
+		return (0);
+	for (; count < frozen->count; count++)
+	{
+		shared = str_frozen_get(frozen->data, &pos);
+		len = str_frozen_get(frozen->data, &pos);
+		memcpy(key + shared, frozen->data + pos, len);
+		key[shared + len] = '\0';
+		pos += len;
+		func(key);
+	}
+	free(key);
+	return (count);
+}
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_key - Prints a key
+ *
+ * @key: Key to print
+ */
+void print_key(const char *key)
+{
+    printf(" %s", key);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    str_bst_t tree = {NULL, NULL, 0};
+    str_frozen_t frozen;
+    const char *keys[] = {
+        "interstellar", "internal", "interval", "in", "index",
+        "internet", "interstate", "intern", "zebra", "apple"
+    };
+    size_t i, rank;
+
+    for (i = 0; i < sizeof(keys) / sizeof(*keys); i++)
+        str_bst_insert(&tree, keys[i]);
+    printf("Inserting \"intern\" again: %s\n",
+           str_bst_insert(&tree, "intern") ? "inserted" : "already there");
+    printf("Root: %s, \"interval\" %s, \"inter\" %s\n", tree.root->key,
+           str_bst_search(&tree, "interval") ? "found" : "not found",
+           str_bst_search(&tree, "inter") ? "found" : "not found");
+    str_bst_remove(&tree, "interstellar");
+    str_bst_remove(&tree, "zebra");
+    printf("After removals, %lu keys, root %s\n", (unsigned long)tree.size,
+           tree.root->key);
+    if (str_bst_freeze(&tree, 4, &frozen) == -1)
+        return (1);
+    printf("Frozen:");
+    str_frozen_walk(&frozen, print_key);
+    printf("\n%lu bytes front-coded\n", (unsigned long)frozen.size);
+    if (str_frozen_search(&frozen, "internet", &rank))
+        printf("\"internet\" has rank %lu\n", (unsigned long)rank);
+    printf("\"interstellar\" %s\n", str_frozen_search(&frozen,
+           "interstellar", NULL) ? "found" : "not found");
+    str_frozen_free(&frozen);
+    str_bst_delete(&tree);
+    return (0);
+}
@@ -0,0 +1,246 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "binary_trees.h"
+
+/**
+ * key_distinct - 1 if the keys built from the benchmark input start with
+ * their distinct part, 0 if with a shared path, set in main before each run
+ */
+static int key_distinct;
+
+/**
+ * str_keys_free - Frees the string keys of a benchmark
+ * @keys: array of keys
+ * @n: number of keys allocated
+ */
+void str_keys_free(char **keys, size_t n)
+{
+    while (n)
+        free(keys[--n]);
+    free(keys);
+}
+
+/**
+ * str_keys - Builds the string keys of a benchmark from its int keys
+ * @b: pointer to the benchmark
+ *
+ * Return: array of b->n keys, or NULL on failure
+ *
+ * Description: each key holds its int key scrambled to 8 hex digits,
+ * after a "users/" or "orders/" path shared by many keys, or first when
+ * key_distinct is set, so that keys differ within their first STR_PREFIX
+ * bytes.
+ */
+char **str_keys(const tree_bench_t *b)
+{
+    char **keys = malloc(sizeof(*keys) * b->n);
+    const char *path;
+    unsigned int key;
+    size_t i;
+
+    if (!keys)
+        return (NULL);
+    for (i = 0; i < b->n; i++)
+    {
+        key = (unsigned int)b->keys[i];
+        path = key & 2 ? "users" : "orders";
+        keys[i] = malloc(48);
+        if (!keys[i])
+        {
+            str_keys_free(keys, i);
+            return (NULL);
+        }
+        if (key_distinct)
+            sprintf(keys[i], "%08x/%s/%u", key * 2654435761u, path,
+                    key % 1000);
+        else
+            sprintf(keys[i], "%s/%08x/%u", path, key * 2654435761u,
+                    key % 1000);
+    }
+    return (keys);
+}
+
+/**
+ * str_tree - Builds the string keys of a benchmark and a tree holding them
+ * @b: pointer to the benchmark
+ * @tree: tree to fill
+ *
+ * Return: array of b->n keys, or NULL on failure
+ */
+char **str_tree(const tree_bench_t *b, str_bst_t *tree)
+{
+    char **keys = str_keys(b);
+    size_t i;
+
+    for (i = 0; keys && i < b->n; i++)
+        str_bst_insert(tree, keys[i]);
+    return (keys);
+}
+
+/**
+ * strcmp_search - Searches a string-keyed tree with strcmp at every node,
+ * as a tree without cached prefixes would
+ * @tree: pointer to the tree
+ * @key: key to search for
+ *
+ * Return: pointer to the node holding the key, or NULL
+ */
+str_node_t *strcmp_search(const str_bst_t *tree, const char *key)
+{
+    str_node_t *node = tree->root;
+    int c;
+
+    while (node)
+    {
+        c = strcmp(key, node->key);
+        if (c == 0)
+            return (node);
+        node = c < 0 ? node->left : node->right;
+    }
+    return (NULL);
+}
+
+/**
+ * bench_str_insert - times str_bst_insert on every key of a benchmark
+ * @b: pointer to the benchmark
+ *
+ * Return: number of operations timed
+ */
+size_t bench_str_insert(tree_bench_t *b)
+{
+    str_bst_t tree = {NULL, NULL, 0};
+    char **keys = str_keys(b);
+    size_t i;
+
+    if (!keys)
+        return (0);
+    bench_start(b);
+    for (i = 0; i < b->n; i++)
+        b->sink += str_bst_insert(&tree, keys[i]) != NULL;
+    bench_stop(b);
+    str_bst_delete(&tree);
+    str_keys_free(keys, b->n);
+    return (b->n);
+}
+
+/**
+ * bench_str_search - times str_bst_search, comparing cached prefixes, on
+ * every key of a benchmark
+ * @b: pointer to the benchmark
+ *
+ * Return: number of operations timed
+ */
+size_t bench_str_search(tree_bench_t *b)
+{
+    str_bst_t tree = {NULL, NULL, 0};
+    char **keys = str_tree(b, &tree);
+    size_t i;
+
+    if (!keys)
+        return (0);
+    bench_start(b);
+    for (i = 0; i < b->n; i++)
+        b->sink += str_bst_search(&tree, keys[i]) != NULL;
+    bench_stop(b);
+    str_bst_delete(&tree);
+    str_keys_free(keys, b->n);
+    return (b->n);
+}
+
+/**
+ * bench_strcmp_search - times searches with strcmp at every node on every
+ * key of a benchmark
+ * @b: pointer to the benchmark
+ *
+ * Return: number of operations timed
+ */
+size_t bench_strcmp_search(tree_bench_t *b)
+{
+    str_bst_t tree = {NULL, NULL, 0};
+    char **keys = str_tree(b, &tree);
+    size_t i;
+
+    if (!keys)
+        return (0);
+    bench_start(b);
+    for (i = 0; i < b->n; i++)
+        b->sink += strcmp_search(&tree, keys[i]) != NULL;
+    bench_stop(b);
+    str_bst_delete(&tree);
+    str_keys_free(keys, b->n);
+    return (b->n);
+}
+
+/**
+ * bench_frozen_search - times str_frozen_search on every key of a
+ * benchmark, and prints the size of the frozen form on stderr
+ * @b: pointer to the benchmark
+ *
+ * Return: number of operations timed
+ */
+size_t bench_frozen_search(tree_bench_t *b)
+{
+    str_bst_t tree = {NULL, NULL, 0};
+    str_frozen_t frozen;
+    char **keys = str_tree(b, &tree);
+    size_t i, bytes = 0;
+
+    if (!keys || str_bst_freeze(&tree, STR_FROZEN_INTERVAL, &frozen) == -1)
+        return (0);
+    bench_start(b);
+    for (i = 0; i < b->n; i++)
+        b->sink += str_frozen_search(&frozen, keys[i], NULL);
+    bench_stop(b);
+    for (i = 0; i < b->n; i++)
+        bytes += strlen(keys[i]);
+    fprintf(stderr, "%s: %lu key bytes, %lu frozen bytes\n",
+            key_distinct ? "distinct" : "shared",
+            (unsigned long)bytes, (unsigned long)frozen.size);
+    str_frozen_free(&frozen);
+    str_bst_delete(&tree);
+    str_keys_free(keys, b->n);
+    return (b->n);
+}
+
+/**
+ * main - Benchmarks string-keyed searches with and without cached
+ * prefixes, and in the frozen form, on path-like keys sharing their first
+ * bytes, then on keys differing within their first STR_PREFIX bytes
+ * @ac: argument count
+ * @av: av[1] is the optional number of keys
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    tree_bench_op_t ops[] = {
+        {NULL, bench_str_insert, 0},
+        {NULL, bench_str_search, 0},
+        {NULL, bench_strcmp_search, 0},
+        {NULL, bench_frozen_search, 0}
+    };
+    const char *names[][4] = {
+        {"str_bst_insert_shared", "str_bst_search_shared",
+         "strcmp_search_shared", "frozen_search_shared"},
+        {"str_bst_insert_distinct", "str_bst_search_distinct",
+         "strcmp_search_distinct", "frozen_search_distinct"}
+    };
+    size_t i, j, n = 200000;
+    int failed = 0;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    printf(BENCH_CSV_HEADER);
+    for (i = 0; i < 2; i++)
+    {
+        key_distinct = (int)i;
+        for (j = 0; j < sizeof(ops) / sizeof(ops[0]); j++)
+        {
+            ops[j].name = names[i][j];
+            if (bench_run(&ops[j], BENCH_RANDOM, n, BENCH_CSV) == -1)
+                failed = 1;
+        }
+    }
+    return (failed);
+}
@@ -0,0 +1,88 @@
+#include "binary_trees.h"
+/**
+* avl_map_height - gives the height of a map subtree
+* @node: pointer to the root node of the subtree
+* Return: the height cached in the node, 0 if it is NULL
+*/
+static int avl_map_height(const avl_t *node)
+{
+	return (node ? (int)node->priority : 0);
+}
+/**
+* avl_map_update - caches the height of a map node from its children
+* @node: pointer to the node
+*/
+static void avl_map_update(avl_t *node)
+{
+	int l = avl_map_height(node->left), r = avl_map_height(node->right);
+
+	node->priority = 1 + (l > r ? l : r);
+}
+/**
+* avl_map_rotate - rotates a map node, updating the cached heights
+* @node: pointer to the node
+* @left: 1 for a left rotation, 0 for a right one
+* Return: pointer to the node that took its place
+*/
+static avl_t *avl_map_rotate(avl_t *node, int left)
+{
+	avl_t *top;
+
+	top = left ? binary_tree_rotate_left(node) :
+		binary_tree_rotate_right(node);
+	avl_map_update(node);
+	avl_map_update(top);
+	return (top);
+}
+/**
+* avl_map_balance - updates the height of a map node and rebalances it
+* @node: pointer to the node
+* Return: pointer to the root node of the subtree, after any rotation
+*/
+avl_map_t *avl_map_balance(avl_map_t *node)
+{
+	avl_t *n = &node->node;
+	int b = avl_map_height(n->left) - avl_map_height(n->right);
+
+	avl_map_update(n);
+	if (b > 1)
+	{
+		TREE_STAT_ADD(rebalances, 1);
+		if (avl_map_height(n->left->left) <
+			avl_map_height(n->left->right))
+			avl_map_rotate(n->left, 1);
+		return ((avl_map_t *)avl_map_rotate(n, 0));
+	}
+	if (b < -1)
+	{
+		TREE_STAT_ADD(rebalances, 1);
+		if (avl_map_height(n->right->right) <
+			avl_map_height(n->right->left))
+			avl_map_rotate(n->right, 0);
+		return ((avl_map_t *)avl_map_rotate(n, 1));
+	}
+	return (node);
+}
+/**
+* avl_map_retrace - rebalances a map from a node up to the root
+* Description: Going up stops as soon as a subtree keeps its height, since
+* nothing above it changes then.
+* @node: pointer to the lowest node whose subtree changed, may be NULL
+* @root: pointer to the root node of the map
+* Return: pointer to the new root node of the map
+*/
+avl_map_t *avl_map_retrace(avl_map_t *node, avl_map_t *root)
+{
+	unsigned int height;
+
+	for (; node; node = (avl_map_t *)node->node.parent)
+	{
+		height = node->node.priority;
+		node = avl_map_balance(node);
+		if (!node->node.parent)
+			return (node);
+		if (node->node.priority == height)
+			return (root);
+	}
+	return (root);
+}
@@ -0,0 +1,111 @@
+#include "binary_trees.h"
+/**
+* avl_map_get_or_insert - finds a key in a map, inserting it if missing
+* Description: A single descent either finds the key or the parent of its
+* new node. Nodes are aligned on a cache line, so the key and its value are
+* read together.
+* @map: double pointer to the root node of the map
+* @key: key to find
+* @value: value to map the key to when inserting it
+* @inserted: set to 1 if the key was inserted, 0 if found, may be NULL
+* Return: pointer to the node holding the key, or NULL on failure
+*/
+avl_map_t *avl_map_get_or_insert(avl_map_t **map, int key, void *value,
+	int *inserted)
+{
+	avl_t *node, *parent = NULL;
+	avl_map_t *new;
+	void *mem;
+
+	if (inserted)
+		*inserted = 0;
+	if (!map)
+		return (NULL);
+	for (node = (avl_t *)*map; node; node = key < node->n ? node->left :
+		node->right)
+	{
+		TREE_STAT_ADD(comparisons, 1);
+		if (key == node->n)
+			return ((avl_map_t *)node);
+		parent = node;
+	}
+	if (posix_memalign(&mem, 64, sizeof(avl_map_t)))
+		return (NULL);
+	new = mem;
+	TREE_STAT_ADD(allocations, 1);
+	TREE_STAT_DEPTH(parent);
+	new->node.n = key;
+	new->node.color = RB_BLACK;
+	new->node.priority = 1;
+	new->node.parent = parent;
+	new->node.left = NULL;
+	new->node.right = NULL;
+	new->value = value;
+	if (parent && key < parent->n)
+		parent->left = &new->node;
+	else if (parent)
+		parent->right = &new->node;
+	*map = avl_map_retrace((avl_map_t *)parent, parent ? *map : new);
+	if (inserted)
+		*inserted = 1;
+	return (new);
+}
+/**
+* avl_map_put - maps a key to a value, replacing any previous value
+* @map: double pointer to the root node of the map
+* @key: key to map
+* @value: value to map the key to
+* Return: pointer to the node holding the key, or NULL on failure
+*/
+avl_map_t *avl_map_put(avl_map_t **map, int key, void *value)
+{
+	avl_map_t *node = avl_map_get_or_insert(map, key, value, NULL);
+
+	if (node)
+		node->value = value;
+	return (node);
+}
+/**
+* avl_map_upsert - inserts or updates the value of a key through a callback
+* @map: double pointer to the root node of the map
+* @key: key to insert or update
+* @func: given the current value, or NULL when inserting, the 0 or 1 the key
+* was found, and @arg, returns the value to store
+* @arg: argument passed to @func
+* Return: pointer to the node holding the key, or NULL on failure
+*/
+avl_map_t *avl_map_upsert(avl_map_t **map, int key,
+	void *(*func)(void *, int, void *), void *arg)
+{
+	avl_map_t *node;
+	int inserted;
+
+	node = avl_map_get_or_insert(map, key, NULL, &inserted);
+	if (node)
+		node->value = func(node->value, !inserted, arg);
+	return (node);
+}
+/**
+* avl_map_get - gets the value mapped to a key
+* @map: pointer to the root node of the map
+* @key: key to look up
+* @value: set to the value when the key is found, may be NULL
+* Return: 1 if the key is found, 0 otherwise
+*/
+int avl_map_get(const avl_map_t *map, int key, void **value)
+{
+	const avl_t *node = (const avl_t *)map;
+
+	while (node)
+	{
+		TREE_STAT_ADD(comparisons, 1);
+		if (key == node->n)
+		{
+			if (value)
+				*value = ((const avl_map_t *)node)->value;
+			return (1);
+		}
+		node = key < node->n ? node->left : node->right;
+	}
+	return (0);
+}
@@ -0,0 +1,73 @@
+#include "binary_trees.h"
+/**
+* avl_map_remove - removes a key and its value from a map
+* Description: As in avl_remove, a node with two children takes the key and
+* value of its successor, whose node is freed instead.
+* @map: pointer to the root node of the map
+* @key: key to remove
+* @value: set to the removed value when the key is found, may be NULL
+* Return: pointer to the new root node of the map
+*/
+avl_map_t *avl_map_remove(avl_map_t *map, int key, void **value)
+{
+	avl_t *node = (avl_t *)map, *next, *child, *parent;
+
+	while (node && node->n != key)
+	{
+		TREE_STAT_ADD(comparisons, 1);
+		node = key < node->n ? node->left : node->right;
+	}
+	if (!node)
+		return (map);
+	if (value)
+		*value = ((avl_map_t *)node)->value;
+	if (node->left && node->right)
+	{
+		for (next = node->right; next->left; next = next->left)
+			;
+		node->n = next->n;
+		((avl_map_t *)node)->value = ((avl_map_t *)next)->value;
+		node = next;
+	}
+	child = node->left ? node->left : node->right;
+	parent = node->parent;
+	if (child)
+		child->parent = parent;
+	if (!parent)
+		map = (avl_map_t *)child;
+	else if (parent->left == node)
+		parent->left = child;
+	else
+		parent->right = child;
+	TREE_STAT_ADD(frees, 1);
+	free(node);
+	return (avl_map_retrace((avl_map_t *)parent, map));
+}
+/**
+* avl_map_delete - frees a map
+* @map: pointer to the root node of the map
+* @free_value: function called on each value, may be NULL
+*/
+void avl_map_delete(avl_map_t *map, void (*free_value)(void *))
+{
+	avl_t *node = (avl_t *)map, *next;
+
+	while (node)
+	{
+		if (node->left)
+		{
+			next = node->left;
+			node->left = next->right;
+			next->right = node;
+		}
+		else
+		{
+			next = node->right;
+			if (free_value)
+				free_value(((avl_map_t *)node)->value);
+			TREE_STAT_ADD(frees, 1);
+			free(node);
+		}
+		node = next;
+	}
+}
@@ -0,0 +1,50 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * count - Counts one more occurrence of a key
+ *
+ * @value: Current count, NULL when the key is new
+ * @found: 1 if the key was already in the map
+ * @arg: Unused
+ *
+ * Return: The new count
+ */
+void *count(void *value, int found, void *arg)
+{
+    (void)arg;
+    return ((void *)((found ? (size_t)value : 0) + 1));
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    avl_map_t *map = NULL;
+    int rolls[] = {3, 5, 3, 12, 7, 5, 3, 9, 7, 3, 11, 2};
+    const char *names[] = {"two", "three", "five"};
+    void *value;
+    size_t i;
+    int inserted;
+
+    for (i = 0; i < sizeof(rolls) / sizeof(*rolls); i++)
+        avl_map_upsert(&map, rolls[i], count, NULL);
+    binary_tree_print(&map->node);
+    for (i = 2; i <= 12; i++)
+        if (avl_map_get(map, (int)i, &value))
+            printf("%lu rolled %lu times\n", (unsigned long)i,
+                   (unsigned long)(size_t)value);
+    avl_map_put(&map, 2, (void *)names[0]);
+    avl_map_put(&map, 3, (void *)names[1]);
+    avl_map_get_or_insert(&map, 5, (void *)names[2], &inserted);
+    printf("5 %s\n", inserted ? "inserted" : "already mapped");
+    map = avl_map_remove(map, 3, &value);
+    printf("Removed 3, mapped to %s\n", (char *)value);
+    binary_tree_print(&map->node);
+    avl_map_delete(map, NULL);
+    return (0);
+}
@@ -0,0 +1,92 @@
+#include "binary_trees.h"
+/**
+* multiset_height - gives the height of a multiset subtree
+* @node: pointer to the root node of the subtree
+* Return: the height cached in the node, 0 if it is NULL
+*/
+static int multiset_height(const avl_t *node)
+{
+	return (node ? (int)node->priority : 0);
+}
+/**
+* multiset_update - caches the height and total of a node from its children
+* @node: pointer to the node
+*/
+static void multiset_update(avl_t *node)
+{
+	int l = multiset_height(node->left), r = multiset_height(node->right);
+	multiset_t *set = (multiset_t *)node;
+
+	node->priority = 1 + (l > r ? l : r);
+	set->total = set->count;
+	if (node->left)
+		set->total += ((multiset_t *)node->left)->total;
+	if (node->right)
+		set->total += ((multiset_t *)node->right)->total;
+}
+/**
+* multiset_rotate - rotates a multiset node, updating heights and totals
+* @node: pointer to the node
+* @left: 1 for a left rotation, 0 for a right one
+* Return: pointer to the node that took its place
+*/
+static avl_t *multiset_rotate(avl_t *node, int left)
+{
+	avl_t *top;
+
+	top = left ? binary_tree_rotate_left(node) :
+		binary_tree_rotate_right(node);
+	multiset_update(node);
+	multiset_update(top);
+	return (top);
+}
+/**
+* multiset_balance - updates a multiset node and rebalances it
+* @node: pointer to the node
+* Return: pointer to the root node of the subtree, after any rotation
+*/
+static avl_t *multiset_balance(avl_t *node)
+{
+	int b = multiset_height(node->left) - multiset_height(node->right);
+
+	multiset_update(node);
+	if (b > 1)
+	{
+		TREE_STAT_ADD(rebalances, 1);
+		if (multiset_height(node->left->left) <
+			multiset_height(node->left->right))
+			multiset_rotate(node->left, 1);
+		return (multiset_rotate(node, 0));
+	}
+	if (b < -1)
+	{
+		TREE_STAT_ADD(rebalances, 1);
+		if (multiset_height(node->right->right) <
+			multiset_height(node->right->left))
+			multiset_rotate(node->right, 0);
+		return (multiset_rotate(node, 1));
+	}
+	return (node);
+}
+/**
+* multiset_retrace - updates heights and totals from a node up to the root,
+* rebalancing on the way
+* Description: Unlike avl_map_retrace, this always reaches the root, since
+* every total above a changed count changes.
+* @node: pointer to the lowest node whose subtree changed, may be NULL
+* @root: pointer to the root node of the multiset
+* Return: pointer to the new root node of the multiset
+*/
+multiset_t *multiset_retrace(multiset_t *node, multiset_t *root)
+{
+	avl_t *n;
+
+	if (!node)
+		return (root);
+	for (n = &node->node; ; n = n->parent)
+	{
+		n = multiset_balance(n);
+		if (!n->parent)
+			return ((multiset_t *)n);
+	}
+}
@@ -0,0 +1,117 @@
+#include "binary_trees.h"
+/**
+* multiset_insert - adds an occurrence of a key to a multiset
+* Description: A key already in the multiset only has its count
+* incremented, without allocating.
+* @set: double pointer to the root node of the multiset
+* @key: key to add
+* Return: pointer to the node holding the key, or NULL on failure
+*/
+multiset_t *multiset_insert(multiset_t **set, int key)
+{
+	avl_t *node, *parent = NULL;
+	multiset_t *new;
+
+	if (!set)
+		return (NULL);
+	for (node = (avl_t *)*set; node; node = key < node->n ? node->left :
+		node->right)
+	{
+		TREE_STAT_ADD(comparisons, 1);
+		if (key == node->n)
+		{
+			((multiset_t *)node)->count++;
+			*set = multiset_retrace((multiset_t *)node, *set);
+			return ((multiset_t *)node);
+		}
+		parent = node;
+	}
+	new = malloc(sizeof(multiset_t));
+	if (!new)
+		return (NULL);
+	TREE_STAT_ADD(allocations, 1);
+	TREE_STAT_DEPTH(parent);
+	new->node.n = key;
+	new->node.color = RB_BLACK;
+	new->node.priority = 1;
+	new->node.parent = parent;
+	new->node.left = NULL;
+	new->node.right = NULL;
+	new->count = 1;
+	new->total = 1;
+	if (parent && key < parent->n)
+		parent->left = &new->node;
+	else if (parent)
+		parent->right = &new->node;
+	*set = multiset_retrace(new, new);
+	return (new);
+}
+/**
+* multiset_remove - removes an occurrence of a key from a multiset
+* Description: The node of the key is only freed with its last occurrence.
+* As in avl_remove, a node with two children then takes the key and count
+* of its successor, whose node is freed instead.
+* @set: pointer to the root node of the multiset
+* @key: key to remove
+* Return: pointer to the new root node of the multiset
+*/
+multiset_t *multiset_remove(multiset_t *set, int key)
+{
+	avl_t *node = (avl_t *)set, *next, *child, *parent;
+
+	while (node && node->n != key)
+	{
+		TREE_STAT_ADD(comparisons, 1);
+		node = key < node->n ? node->left : node->right;
+	}
+	if (!node)
+		return (set);
+	if (--((multiset_t *)node)->count)
+		return (multiset_retrace((multiset_t *)node, set));
+	if (node->left && node->right)
+	{
+		for (next = node->right; next->left; next = next->left)
+			;
+		node->n = next->n;
+		((multiset_t *)node)->count = ((multiset_t *)next)->count;
+		node = next;
+	}
+	child = node->left ? node->left : node->right;
+	parent = node->parent;
+	if (child)
+		child->parent = parent;
+	if (!parent)
+		set = (multiset_t *)child;
+	else if (parent->left == node)
+		parent->left = child;
+	else
+		parent->right = child;
+	TREE_STAT_ADD(frees, 1);
+	free(node);
+	return (multiset_retrace((multiset_t *)parent, set));
+}
+/**
+* multiset_delete - frees a multiset
+* @set: pointer to the root node of the multiset
+*/
+void multiset_delete(multiset_t *set)
+{
+	avl_t *node = (avl_t *)set, *next;
+
+	while (node)
+	{
+		if (node->left)
+		{
+			next = node->left;
+			node->left = next->right;
+			next->right = node;
+		}
+		else
+		{
+			next = node->right;
+			TREE_STAT_ADD(frees, 1);
+			free(node);
+		}
+		node = next;
+	}
+}
@@ -0,0 +1,117 @@
+#include "binary_trees.h"
+/**
+* multiset_total - gives the number of occurrences in a multiset subtree
+* @node: pointer to the root node of the subtree
+* Return: the total cached in the node, 0 if it is NULL
+*/
+static size_t multiset_total(const avl_t *node)
+{
+	return (node ? ((const multiset_t *)node)->total : 0);
+}
+/**
+* multiset_count - counts the occurrences of a key in a multiset
+* @set: pointer to the root node of the multiset
+* @key: key to count
+* Return: number of occurrences of the key
+*/
+size_t multiset_count(const multiset_t *set, int key)
+{
+	const avl_t *node = (const avl_t *)set;
+
+	while (node)
+	{
+		TREE_STAT_ADD(comparisons, 1);
+		if (key == node->n)
+			return (((const multiset_t *)node)->count);
+		node = key < node->n ? node->left : node->right;
+	}
+	return (0);
+}
+/**
+* multiset_rank - counts the occurrences of keys smaller than a key
+* @set: pointer to the root node of the multiset
+* @key: the key, which need not be in the multiset
+* Return: number of occurrences of smaller keys
+*/
+size_t multiset_rank(const multiset_t *set, int key)
+{
+	const avl_t *node = (const avl_t *)set;
+	size_t rank = 0;
+
+	while (node)
+	{
+		TREE_STAT_ADD(comparisons, 1);
+		if (key <= node->n)
+		{
+			if (key == node->n)
+				return (rank + multiset_total(node->left));
+			node = node->left;
+			continue;
+		}
+		rank += multiset_total(node->left) +
+			((const multiset_t *)node)->count;
+		node = node->right;
+	}
+	return (rank);
+}
+/**
+* multiset_select - finds the key of an occurrence by its rank
+* @set: pointer to the root node of the multiset
+* @rank: number of occurrences before the one to find, counting repeats
+* @key: set to the key found
+* Return: 1 if the rank is below the size of the multiset, 0 otherwise
+*/
+int multiset_select(const multiset_t *set, size_t rank, int *key)
+{
+	const avl_t *node = (const avl_t *)set;
+	size_t left;
+
+	if (rank >= multiset_total(node))
+		return (0);
+	while (1)
+	{
+		left = multiset_total(node->left);
+		if (rank < left)
+			node = node->left;
+		else if (rank - left < ((const multiset_t *)node)->count)
+		{
+			*key = node->n;
+			return (1);
+		}
+		else
+		{
+			rank -= left + ((const multiset_t *)node)->count;
+			node = node->right;
+		}
+	}
+}
+/**
+* multiset_walk - goes through the keys of a multiset and their counts, in
+* order
+* @set: pointer to the root node of the multiset
+* @func: pointer to a function to call with each key and its count
+* Return: number of distinct keys
+*/
+size_t multiset_walk(const multiset_t *set, void (*func)(int, size_t))
+{
+	const avl_t *node = (const avl_t *)set;
+	size_t keys = 0;
+
+	while (node && node->left)
+		node = node->left;
+	while (node)
+	{
+		func(node->n, ((const multiset_t *)node)->count);
+		keys++;
+		if (node->right)
+		{
+			for (node = node->right; node->left; node = node->left)
+				;
+			continue;
+		}
+		while (node->parent && node->parent->right == node)
+			node = node->parent;
+		node = node->parent;
+	}
+	return (keys);
+}
@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_bar - Prints a histogram bar
+ *
+ * @key: Latency bucket
+ * @count: Number of samples in the bucket
+ */
+void print_bar(int key, size_t count)
+{
+    printf("%3d ms %2lu ", key, (unsigned long)count);
+    while (count--)
+        printf("#");
+    printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    multiset_t *set = NULL;
+    int samples[] = {
+        12, 15, 12, 40, 15, 12, 18, 15, 12, 90,
+        18, 12, 15, 40, 12, 15, 18, 12, 25, 15
+    };
+    size_t i, n = sizeof(samples) / sizeof(*samples);
+    int median, p90;
+
+    for (i = 0; i < n; i++)
+        multiset_insert(&set, samples[i]);
+    printf("%lu distinct latencies\n",
+           (unsigned long)multiset_walk(set, print_bar));
+    multiset_select(set, n / 2, &median);
+    multiset_select(set, n * 9 / 10, &p90);
+    printf("Median %d ms, p90 %d ms\n", median, p90);
+    printf("%lu samples below 18 ms\n",
+           (unsigned long)multiset_rank(set, 18));
+    set = multiset_remove(set, 90);
+    set = multiset_remove(set, 12);
+    printf("After removing 90 and one 12: %lu x 12, %lu x 90, %lu samples\n",
+           (unsigned long)multiset_count(set, 12),
+           (unsigned long)multiset_count(set, 90),
+           (unsigned long)set->total);
+    multiset_delete(set);
+    return (0);
+}
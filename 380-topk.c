@@ -0,0 +1,111 @@
+#include "binary_trees.h"
+/**
+* topk_create - creates a selection of the greatest values of a stream
+* @k: number of values to keep
+* Return: pointer to the selection, or NULL on failure
+*/
+topk_t *topk_create(size_t k)
+{
+	topk_t *topk;
+
+	topk = malloc(sizeof(topk_t));
+	if (!topk)
+		return (NULL);
+	topk->heap = malloc(sizeof(int) * (k ? k : 1));
+	if (!topk->heap)
+	{
+		free(topk);
+		return (NULL);
+	}
+	topk->k = k;
+	topk->size = 0;
+	topk->seen = 0;
+	return (topk);
+}
+/**
+* topk_sift_down - moves a value down a min-heap to its place
+* @heap: the heap
+* @size: number of values in the heap
+* @i: index of the value
+*/
+static void topk_sift_down(int *heap, size_t size, size_t i)
+{
+	size_t child;
+	int value = heap[i];
+
+	while ((child = 2 * i + 1) < size)
+	{
+		if (child + 1 < size && heap[child + 1] < heap[child])
+			child++;
+		if (heap[child] >= value)
+			break;
+		heap[i] = heap[child];
+		i = child;
+	}
+	heap[i] = value;
+}
+/**
+* topk_push - offers a value to a top-K selection
+* Description: Once k values are kept, a value only replaces the smallest
+* one when it is greater, so ties keep the earliest values.
+* @topk: pointer to the selection
+* @value: value offered
+* Return: 1 if the value is kept, 0 otherwise
+*/
+int topk_push(topk_t *topk, int value)
+{
+	size_t i;
+
+	topk->seen++;
+	if (topk->size < topk->k)
+	{
+		for (i = topk->size++; i && topk->heap[(i - 1) / 2] > value;
+			i = (i - 1) / 2)
+			topk->heap[i] = topk->heap[(i - 1) / 2];
+		topk->heap[i] = value;
+		return (1);
+	}
+	if (!topk->k || value <= topk->heap[0])
+		return (0);
+	topk->heap[0] = value;
+	topk_sift_down(topk->heap, topk->size, 0);
+	return (1);
+}
+/**
+* topk_to_sorted_array - converts a top-K selection to a sorted array
+* Description: Sorts the heap in place, moving the smallest value to the
+* end each time, and hands it over as the array.
+* @topk: pointer to the selection, freed
+* @size: address to store the size of the array
+* Return: pointer to the array sorted in descending order, or NULL
+*/
+int *topk_to_sorted_array(topk_t *topk, size_t *size)
+{
+	int *a, last;
+	size_t end;
+
+	if (!topk || !size)
+		return (NULL);
+	a = topk->heap;
+	*size = topk->size;
+	for (end = topk->size; end > 1; end--)
+	{
+		last = a[end - 1];
+		a[end - 1] = a[0];
+		a[0] = last;
+		topk_sift_down(a, end - 1, 0);
+	}
+	free(topk);
+	return (a);
+}
+/**
+* topk_free - frees a top-K selection
+* @topk: pointer to the selection
+*/
+void topk_free(topk_t *topk)
+{
+	if (!topk)
+		return;
+	free(topk->heap);
+	free(topk);
+}
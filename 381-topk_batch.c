@@ -0,0 +1,65 @@
+#include <string.h>
+#include "binary_trees.h"
+
+typedef int topk_vec_t __attribute__((vector_size(16)));
+typedef unsigned long topk_mask_t __attribute__((vector_size(16)));
+
+/**
+* topk_any - tells if any of TOPK_LANES values beats a threshold
+* Description: The values are compared four at a time in vector registers,
+* and the comparisons merged so that a single test decides the block.
+* @values: the values, with no alignment required
+* @t: pointer to the threshold, in every lane
+* Return: nonzero if a value is greater than the threshold
+*/
+static int topk_any(const int *values, const topk_vec_t *t)
+{
+	topk_vec_t v[TOPK_LANES / 4], m;
+	topk_mask_t w;
+	unsigned long any = 0;
+	size_t j;
+
+	memcpy(v, values, sizeof(v));
+	m = v[0] > *t;
+	for (j = 1; j < TOPK_LANES / 4; j++)
+		m |= v[j] > *t;
+	w = (topk_mask_t)m;
+	for (j = 0; j < sizeof(w) / sizeof(w[0]); j++)
+		any |= w[j];
+	return (any != 0);
+}
+/**
+* topk_push_batch - offers an array of values to a top-K selection
+* Description: Once k values are kept, blocks of TOPK_LANES values are
+* compared against the smallest kept one in vector registers, and only
+* blocks holding a greater value go through topk_push. Past the first
+* values of a long stream, almost every block is skipped this way.
+* @topk: pointer to the selection
+* @values: values offered, in stream order
+* @n: number of values
+* Return: number of values kept when offered
+*/
+size_t topk_push_batch(topk_t *topk, const int *values, size_t n)
+{
+	unsigned long seen = topk->seen + n;
+	size_t i = 0, j, kept = 0;
+	topk_vec_t t;
+
+	for (; i < n && topk->size < topk->k; i++)
+		kept += topk_push(topk, values[i]);
+	for (; topk->k && i + TOPK_LANES <= n; i += TOPK_LANES)
+	{
+		for (j = 0; j < sizeof(t) / sizeof(t[0]); j++)
+			t[j] = topk->heap[0];
+		while (i + TOPK_LANES <= n && !topk_any(values + i, &t))
+			i += TOPK_LANES;
+		if (i + TOPK_LANES > n)
+			break;
+		for (j = 0; j < TOPK_LANES; j++)
+			kept += topk_push(topk, values[i + j]);
+	}
+	for (; i < n; i++)
+		kept += topk_push(topk, values[i]);
+	topk->seen = seen;
+	return (kept);
+}
@@ -0,0 +1,54 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_array - Prints an array of integers
+ *
+ * @array: The array to be printed
+ * @size: Number of elements in @array
+ */
+void print_array(const int *array, size_t size)
+{
+    size_t i;
+
+    i = 0;
+    while (array && i < size)
+    {
+        if (i > 0)
+            printf(", ");
+        printf("%d", array[i]);
+        ++i;
+    }
+    printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    topk_t *topk;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95, 87, 13, 50, 99
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    int *sorted;
+    size_t sorted_size, kept;
+
+    print_array(array, n);
+    topk = topk_create(5);
+    if (!topk)
+        return (1);
+    topk_push(topk, 42);
+    kept = topk_push_batch(topk, array, n);
+    printf("%lu of %lu values kept when offered, smallest kept %d\n",
+           (unsigned long)kept + 1, topk->seen, topk->heap[0]);
+    sorted = topk_to_sorted_array(topk, &sorted_size);
+    print_array(sorted, sorted_size);
+    free(sorted);
+    return (0);
+}
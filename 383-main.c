@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * topk_size - number of values kept by the runs, set in main before each
+ */
+static size_t topk_size;
+
+/**
+ * topk_run - selects the greatest keys of a benchmark, timing the offers
+ * @b: pointer to the benchmark
+ * @batch: 1 to offer the keys with topk_push_batch, 0 with topk_push
+ *
+ * Return: number of values offered
+ */
+size_t topk_run(tree_bench_t *b, int batch)
+{
+    topk_t *topk = topk_create(topk_size);
+    size_t i, size;
+    int *sorted;
+
+    if (!topk)
+        return (0);
+    bench_start(b);
+    if (batch)
+        topk_push_batch(topk, b->keys, b->n);
+    else
+        for (i = 0; i < b->n; i++)
+            topk_push(topk, b->keys[i]);
+    sorted = topk_to_sorted_array(topk, &size);
+    bench_stop(b);
+    if (!sorted)
+        return (0);
+    b->sink += size ? (size_t)sorted[0] : 0;
+    free(sorted);
+    return (b->n);
+}
+
+/**
+ * bench_topk_push - times topk_push on every key of a benchmark
+ * @b: pointer to the benchmark
+ *
+ * Return: number of values offered
+ */
+size_t bench_topk_push(tree_bench_t *b)
+{
+    return (topk_run(b, 0));
+}
+
+/**
+ * bench_topk_batch - times topk_push_batch on the keys of a benchmark
+ * @b: pointer to the benchmark
+ *
+ * Return: number of values offered
+ */
+size_t bench_topk_batch(tree_bench_t *b)
+{
+    return (topk_run(b, 1));
+}
+
+/**
+ * main - Benchmarks top-K selection value by value and in batches
+ * @ac: argument count
+ * @av: av[1] is the optional number of values
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    tree_bench_op_t ops[] = {
+        {NULL, bench_topk_push, 0},
+        {NULL, bench_topk_batch, 0}
+    };
+    const char *names[][2] = {
+        {"topk_push_10", "topk_batch_10"},
+        {"topk_push_100", "topk_batch_100"},
+        {"topk_push_1000", "topk_batch_1000"},
+        {"topk_push_10000", "topk_batch_10000"}
+    };
+    size_t i, j, n = 10000000, ks[] = {10, 100, 1000, 10000};
+    int failed = 0;
+
+    if (ac > 1)
+        n = strtoul(av[1], NULL, 10);
+    printf(BENCH_CSV_HEADER);
+    for (i = 0; i < sizeof(ks) / sizeof(*ks); i++)
+    {
+        topk_size = ks[i];
+        for (j = 0; j < 2; j++)
+        {
+            ops[j].name = names[i][j];
+            if (bench_run(&ops[j], BENCH_RANDOM, n, BENCH_CSV) == -1)
+                failed = 1;
+        }
+    }
+    return (failed);
+}
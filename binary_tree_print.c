@@ -3,97 +3,186 @@
 #include <string.h>
 #include "binary_trees.h"
 
-/* Original code from http://stackoverflow.com/a/13755911/5184480 */
+/* Layout from http://stackoverflow.com/a/13755911/5184480 */
 
 /**
- * print_t - Stores recursively each level in an array of strings
+ * tree_print_fill - Fills a range of a line, clipped to the line width
  *
- * @tree: Pointer to the node to print
- * @offset: Offset to print
- * @depth: Depth of the node
- * @s: Buffer
+ * @p: Rendering state
+ * @row: Line to fill
+ * @from: First column to fill
+ * @to: Column after the last one to fill
+ * @s: Characters to write, or a single character repeated if @s[1] is 0
+ */
+static void tree_print_fill(tree_print_t *p, size_t row, size_t from,
+	size_t to, const char *s)
+{
+	char *line = p->grid + row * (p->cols + 1);
+	size_t i;
+
+	if (to > p->cols)
+		line[p->cols] = '>';
+	for (i = from; i < to && i < p->cols; i++)
+		line[i] = s[1] ? s[i - from] : s[0];
+}
+
+/**
+ * tree_print_node - Renders a node and the branches to its children
  *
- * Return: length of printed tree after process
+ * Description: A subtree at the maximum depth is rendered as "(...)".
+ * While measuring, only the size of the rendering is computed.
+ * @node: Pointer to the node to render
+ * @p: Rendering state
+ * @right: 1 if the node is the right child of the node above it
  */
-static int print_t(const binary_tree_t *tree, int offset, int depth, char **s)
+static void tree_print_node(const binary_tree_t *node, tree_print_t *p,
+	int right)
 {
-	char b[6];
-	int width, left, right, is_left, i;
+	char b[16];
+	size_t d = p->depth, w, c;
 
-	if (!tree)
-		return (0);
-	is_left = (tree->parent && tree->parent->left == tree);
-	width = sprintf(b, "(%03d)", tree->n);
-	left = print_t(tree->left, offset, depth + 1, s);
-	right = print_t(tree->right, offset + left + width, depth + 1, s);
-	for (i = 0; i < width; i++)
-		s[depth][offset + left + i] = b[i];
-	if (depth && is_left)
+	if (d == p->max_depth && (node->left || node->right))
+		w = sprintf(b, "(...)");
+	else
+		w = sprintf(b, "(%03d)", node->n);
+	if (!p->grid)
+	{
+		p->rows = d + 1 > p->rows ? d + 1 : p->rows;
+		p->col += w;
+		return;
+	}
+	if (node->left && d < p->max_depth)
 	{
-		for (i = 0; i < width + right; i++)
-			s[depth - 1][offset + left + width / 2 + i] = '-';
-		s[depth - 1][offset + left + width / 2] = '.';
+		c = p->pos[2 * d + 2] + p->pos[2 * d + 3] / 2;
+		tree_print_fill(p, d, c, c + 1, ".");
+		tree_print_fill(p, d, c + 1, p->col, "-");
 	}
-	else if (depth && !is_left)
+	tree_print_fill(p, d, p->col, p->col + w, b);
+	if (right)
 	{
-		for (i = 0; i < left + width; i++)
-			s[depth - 1][offset - width / 2 + i] = '-';
-		s[depth - 1][offset + left + width / 2] = '.';
+		c = p->col + w / 2;
+		tree_print_fill(p, d - 1, p->pos[2 * d - 2] + p->pos[2 * d - 1],
+			c, "-");
+		tree_print_fill(p, d - 1, c, c + 1, ".");
 	}
-	return (left + width + right);
+	p->pos[2 * d] = p->col;
+	p->pos[2 * d + 1] = w;
+	p->col += w;
 }
 
 /**
- * _height - Measures the height of a binary tree
+ * tree_print_walk - Renders or measures every node of a subtree, in in-order
  *
- * @tree: Pointer to the node to measures the height
- *
- * Return: The height of the tree starting at @node
+ * Description: The side of each child is taken from the walk, so that
+ * parent pointers are never followed.
+ * @node: Pointer to the root node of the subtree
+ * @p: Rendering state, whose depth is that of @node
+ * @right: 1 if @node is the right child of the node above it
  */
-static size_t _height(const binary_tree_t *tree)
+static void tree_print_walk(const binary_tree_t *node, tree_print_t *p,
+	int right)
 {
-	size_t height_l;
-	size_t height_r;
+	size_t d = p->depth;
 
-	height_l = tree->left ? 1 + _height(tree->left) : 0;
-	height_r = tree->right ? 1 + _height(tree->right) : 0;
-	return (height_l > height_r ? height_l : height_r);
+	if (node->left && d < p->max_depth)
+	{
+		p->depth = d + 1;
+		tree_print_walk(node->left, p, 0);
+		p->depth = d;
+	}
+	tree_print_node(node, p, right);
+	if (node->right && d < p->max_depth)
+	{
+		p->depth = d + 1;
+		tree_print_walk(node->right, p, 1);
+		p->depth = d;
+	}
 }
 
 /**
- * binary_tree_print - Prints a binary tree
+ * binary_tree_render - Renders a binary tree into a memory buffer
  *
- * @tree: Pointer to the root node of the tree to print
+ * Description: A first pass measures the rendering, which is then drawn
+ * into a single buffer. Lines cut by @max_width end with "...".
+ * @tree: Pointer to the root node of the tree to render
+ * @max_depth: Number of levels to render, 0 for no limit
+ * @max_width: Number of columns to render, 0 for no limit
+ * @len: Set to the length of the rendering
+ *
+ * Return: The lines of the rendering, to be freed, or NULL on failure
  */
-void binary_tree_print(const binary_tree_t *tree)
+char *binary_tree_render(const binary_tree_t *tree, size_t max_depth,
+	size_t max_width, size_t *len)
 {
-	char **s;
-	size_t height, i, j;
+	tree_print_t p = {0, 0, 0, 0, 0, NULL, NULL};
+	size_t row, end, size;
+	char *buf, *line;
 
+	*len = 0;
 	if (!tree)
-		return;
-	height = _height(tree);
-	s = malloc(sizeof(*s) * (height + 1));
-	if (!s)
-		return;
-	for (i = 0; i < height + 1; i++)
+		return (NULL);
+	p.max_depth = max_depth ? max_depth - 1 : (size_t)-1;
+	tree_print_walk(tree, &p, 0);
+	p.cols = max_width && max_width < p.col ? max_width : p.col;
+	size = p.rows * sizeof(size_t) * 2;
+	if ((p.cols + 1) > ((size_t)-1 - size - 1) / p.rows)
+		return (NULL);
+	buf = malloc(size + p.rows * (p.cols + 1) + 1);
+	if (!buf)
+		return (NULL);
+	p.pos = (size_t *)buf;
+	p.grid = buf + size;
+	memset(p.grid, ' ', p.rows * (p.cols + 1));
+	p.col = 0;
+	tree_print_walk(tree, &p, 0);
+	for (row = 0; row < p.rows; row++)
 	{
-		s[i] = malloc(sizeof(**s) * 255);
-		if (!s[i])
-			return;
-		memset(s[i], 32, 255);
+		line = p.grid + row * (p.cols + 1);
+		if (line[p.cols] == '>' && p.cols >= 3)
+			memcpy(line + p.cols - 3, "...", 3);
+		for (end = p.cols; end > 0 && line[end - 1] == ' '; end--)
+			;
+		memmove(buf + *len, line, end);
+		*len += end;
+		buf[(*len)++] = '\n';
 	}
-	print_t(tree, 0, 0, s);
-	for (i = 0; i < height + 1; i++)
-	{
-		for (j = 254; j > 1; --j)
-		{
-			if (s[i][j] != ' ')
-				break;
-			s[i][j] = '\0';
-		}
-		printf("%s\n", s[i]);
-		free(s[i]);
-	}
-	free(s);
+	buf[*len] = '\0';
+	return (buf);
+}
+
+/**
+ * binary_tree_fprint - Prints a binary tree to a stream with one write
+ *
+ * @stream: Stream to print to
+ * @tree: Pointer to the root node of the tree to print
+ * @max_depth: Number of levels to print, 0 for no limit
+ * @max_width: Number of columns to print, 0 for no limit
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int binary_tree_fprint(FILE *stream, const binary_tree_t *tree,
+	size_t max_depth, size_t max_width)
+{
+	char *buf;
+	size_t len;
+	int ret;
+
+	if (!tree)
+		return (0);
+	buf = binary_tree_render(tree, max_depth, max_width, &len);
+	if (!buf)
+		return (-1);
+	ret = fwrite(buf, 1, len, stream) == len ? 0 : -1;
+	free(buf);
+	return (ret);
+}
+
+/**
+ * binary_tree_print - Prints a binary tree
+ *
+ * @tree: Pointer to the root node of the tree to print
+ */
+void binary_tree_print(const binary_tree_t *tree)
+{
+	binary_tree_fprint(stdout, tree, 0, 0);
 }
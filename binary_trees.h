@@ -3,11 +3,16 @@
 
 #include<stdio.h>
 #include<stdlib.h>
+#include<pthread.h>
+#include<stdint.h>
+#include<time.h>
 
 /**
 * struct binary_tree_s - Binary tree node
 *
 * @n: Integer stored in the node
+* @color: Red-black colour bit, packed into the padding after @n
+* @priority: Treap heap priority, sharing the padding word with @color
 * @parent: Pointer to the parent node
 * @left: Pointer to the left child node
 * @right: Pointer to the right child node
@@ -15,6 +20,8 @@
 struct binary_tree_s
 {
 	int n;
+	unsigned int color : 1;
+	unsigned int priority : 31;
 
 	struct binary_tree_s *parent;
 	struct binary_tree_s *left;
@@ -29,7 +36,783 @@ typedef struct binary_tree_s avl_t;
 
 typedef struct binary_tree_s heap_t;
 
+typedef struct binary_tree_s rb_t;
+
+typedef struct binary_tree_s splay_t;
+
+/**
+* struct treap_s - Treap handle
+*
+* @root: Pointer to the root node of the treap
+* @seed: State of the xorshift generator drawing the node priorities
+*/
+typedef struct treap_s
+{
+	binary_tree_t *root;
+	unsigned int seed;
+} treap_t;
+
+/**
+* struct scapegoat_s - Scapegoat Tree handle, plain BST nodes carrying no
+* balance metadata
+*
+* @root: Pointer to the root node of the tree, searched with bst_search
+* @size: Number of nodes in the tree
+* @max_size: Largest size reached since the last full rebuild
+*/
+typedef struct scapegoat_s
+{
+	bst_t *root;
+	size_t size;
+	size_t max_size;
+} scapegoat_t;
+
+#define BPLUS_ORDER 14
+#define BPLUS_MIN ((BPLUS_ORDER - 1) / 2)
+
+/**
+* struct bplus_node_s - B+ tree node, three 64-byte cache lines: the header
+* and the keys share the first line, the pointers fill the other two
+*
+* @count: Number of keys stored in the node
+* @leaf: 1 if the node is a leaf, 0 if it is an internal node
+* @keys: Sorted keys; in an internal node keys[i] separates children[i]
+* (smaller keys) from children[i + 1] (greater or equal keys)
+* @children: Child pointers of an internal node
+* @next: Next leaf in key order, NULL for internal nodes and the last leaf
+*/
+typedef struct bplus_node_s
+{
+	int count;
+	int leaf;
+	int keys[BPLUS_ORDER];
+	struct bplus_node_s *children[BPLUS_ORDER + 1];
+	struct bplus_node_s *next;
+} bplus_t;
+
+#define CNODE_NIL 0
+#define CNODE_MAX ((1u << 30) - 1)
+
+/**
+* struct cnode_s - Compact tree node, 12 bytes, linked by 32-bit pool indexes
+* instead of pointers; slot CNODE_NIL of the pool is never used
+*
+* @n: Integer stored in the node
+* @left: Index of the left child node
+* @right: Index of the right child node
+* @balance: AVL balance factor (left height - right height) plus 1
+*/
+typedef struct cnode_s
+{
+	int n;
+	unsigned int left;
+	unsigned int right : 30;
+	unsigned int balance : 2;
+} cnode_t;
+
+/**
+* struct cpool_s - Contiguous pool holding the nodes of one compact tree
+*
+* @nodes: Array of nodes, grown by doubling
+* @size: Number of slots used, including the reserved slot CNODE_NIL
+* @capacity: Number of slots allocated
+* @free_list: Index of the first released node, chained through @left
+* @root: Index of the root node of the tree, CNODE_NIL if it is empty
+*/
+typedef struct cpool_s
+{
+	cnode_t *nodes;
+	unsigned int size;
+	unsigned int capacity;
+	unsigned int free_list;
+	unsigned int root;
+} cpool_t;
+
+/**
+* struct cheap_s - Compact Max Binary Heap stored as an implicit array,
+* the children of the value at index i being at 2i + 1 and 2i + 2
+*
+* @keys: Array of values in level order
+* @size: Number of values in the heap
+* @capacity: Number of values allocated
+*/
+typedef struct cheap_s
+{
+	int *keys;
+	size_t size;
+	size_t capacity;
+} cheap_t;
+
+/**
+* struct lean_tree_s - Binary tree node without a parent pointer, 24 bytes
+* instead of 32; upward navigation goes through a lean_path_t
+*
+* @n: Integer stored in the node
+* @left: Pointer to the left child node
+* @right: Pointer to the right child node
+*/
+typedef struct lean_tree_s
+{
+	int n;
+	struct lean_tree_s *left;
+	struct lean_tree_s *right;
+} lean_tree_t;
+
+/**
+* struct lean_path_s - Stack of the nodes from a root down to a node
+*
+* @nodes: Array of nodes, nodes[0] being the root
+* @size: Number of nodes on the stack
+* @capacity: Number of nodes allocated
+*/
+typedef struct lean_path_s
+{
+	lean_tree_t **nodes;
+	size_t size;
+	size_t capacity;
+} lean_path_t;
+
+/**
+* struct pavl_s - Persistent AVL tree node; nodes are never modified once
+* built and are shared between versions, so they have no parent pointer
+*
+* @n: Integer stored in the node
+* @height: Height of the subtree rooted at the node, counting the node
+* @refs: Number of versions and parent nodes referencing the node
+* @left: Pointer to the left child node
+* @right: Pointer to the right child node
+*/
+typedef struct pavl_s
+{
+	int n;
+	int height;
+	unsigned int refs;
+	struct pavl_s *left;
+	struct pavl_s *right;
+} pavl_t;
+
+#define TREE_READERS 64
+
+/**
+* struct tree_slot_s - Reader slot of a tree handle, alone on its cache line
+*
+* @active: 1 while the reader is inside the tree, 0 otherwise
+* @pad: Padding up to the size of a cache line
+*
+* Description: The slot is aligned on a cache line, so the slots of a
+* handle start on a line of their own, after the writer lock.
+*/
+typedef struct tree_slot_s
+{
+	unsigned int active;
+	char pad[64 - sizeof(unsigned int)];
+} __attribute__((aligned(64))) tree_slot_t;
+
+/**
+* struct tree_handle_s - Thread-safe handle on an AVL tree
+*
+* @root: Pointer to the root node of the tree
+* @seq: Sequence counter, odd while a writer is changing the tree
+* @pad: Padding keeping @seq away from the writer lock
+* @lock: Mutex serializing the writers
+* @slots: One slot per reader thread
+*/
+typedef struct tree_handle_s
+{
+	avl_t *root;
+	unsigned int seq;
+	char pad[64 - sizeof(avl_t *) - sizeof(unsigned int)];
+	pthread_mutex_t lock;
+	tree_slot_t slots[TREE_READERS];
+} tree_handle_t;
+
+#define CONC_THREADS 64
+
+/**
+* struct conc_node_s - Node of a concurrent external BST: the values live in
+* the leaves, the internal nodes only route the searches
+*
+* @n: Integer stored in the node; an internal node sends smaller values to
+* the left and greater or equal values to the right
+* @leaf: 1 if the node is a leaf, 0 if it is an internal node
+* @inf: 0 for a real value, 1 or 2 for the two sentinel keys above INT_MAX
+* @removed: Set, under @lock, once the node is unlinked from the tree
+* @lock: Spin lock taken by the writers changing the node's children
+* @epoch: Epoch at which the node was unlinked
+* @left: Pointer to the left child node
+* @right: Pointer to the right child node
+* @next: Next node on the retired list of the thread that unlinked it
+*/
+typedef struct conc_node_s
+{
+	int n;
+	unsigned char leaf;
+	unsigned char inf;
+	unsigned char removed;
+	unsigned int lock;
+	unsigned int epoch;
+	struct conc_node_s *left;
+	struct conc_node_s *right;
+	struct conc_node_s *next;
+} conc_node_t;
+
+/**
+* struct conc_thread_s - Per-thread state of a concurrent BST, alone on its
+* cache line
+*
+* @state: Epoch seen by the thread, shifted left once, with the low bit set
+* while the thread is inside the tree; 0 when it is outside
+* @count: Number of nodes on @retired
+* @retired: Nodes unlinked by the thread and not yet freed, newest first
+* @pad: Padding up to the size of a cache line
+*/
+typedef struct conc_thread_s
+{
+	unsigned int state;
+	unsigned int count;
+	conc_node_t *retired;
+	char pad[64 - 2 * sizeof(unsigned int) - sizeof(conc_node_t *)];
+} conc_thread_t;
+
+/**
+* struct conc_bst_s - Concurrent BST handle
+*
+* @root: Pointer to the sentinel root node, never removed
+* @epoch: Global reclamation epoch
+* @pad: Padding keeping @epoch away from the thread states
+* @threads: One state per thread using the tree
+*/
+typedef struct conc_bst_s
+{
+	conc_node_t *root;
+	unsigned int epoch;
+	char pad[64 - sizeof(conc_node_t *) - sizeof(unsigned int)];
+	conc_thread_t threads[CONC_THREADS];
+} conc_bst_t;
+
+/**
+* struct mq_queue_s - Sub-queue of a MultiQueue, alone on its cache line
+*
+* @heap: Compact Max Binary Heap holding the values of the sub-queue
+* @lock: Spin lock guarding @heap
+* @top: Copy of the greatest value of @heap, read without the lock
+* @filled: 1 if @heap holds at least one value, read without the lock
+* @pad: Padding up to the size of a cache line
+*/
+typedef struct mq_queue_s
+{
+	cheap_t heap;
+	unsigned int lock;
+	int top;
+	unsigned int filled;
+	char pad[64 - sizeof(cheap_t) - 3 * sizeof(int)];
+} mq_queue_t;
+
+/**
+* struct mq_s - MultiQueue: a relaxed concurrent Max Priority Queue spread
+* over several locked sub-queues
+*
+* @queues: Array of the sub-queues
+* @count: Number of sub-queues
+*/
+typedef struct mq_s
+{
+	mq_queue_t *queues;
+	size_t count;
+} mq_t;
+
+#define TREE_WALK_STACK 64
+
+/**
+* struct tree_task_s - Subtree waiting to be reduced by a parallel reduction
+*
+* @node: Pointer to the root node of the subtree
+* @depth: Depth of @node in the whole tree
+*/
+typedef struct tree_task_s
+{
+	const binary_tree_t *node;
+	size_t depth;
+} tree_task_t;
+
+/**
+* struct tree_deque_s - Task deque of a parallel reduction worker: the owner
+* works at the tail, thieves steal from the head
+*
+* @tasks: Array of the tasks
+* @head: Index of the oldest task
+* @tail: Index past the newest task
+* @capacity: Number of tasks @tasks can hold
+* @lock: Mutex guarding the deque
+*/
+typedef struct tree_deque_s
+{
+	tree_task_t *tasks;
+	size_t head;
+	size_t tail;
+	size_t capacity;
+	pthread_mutex_t lock;
+} tree_deque_t;
+
+/**
+* struct tree_worker_s - Worker thread of a parallel reduction
+*
+* @par: Pointer to the reduction the worker belongs to
+* @deque: Tasks of the worker
+* @result: Combination of every value the worker mapped
+* @seed: Xorshift state drawing the victims to steal from
+* @thread: Thread running the worker
+* @pad: Padding keeping @result off the next worker's cache line
+*/
+typedef struct tree_worker_s
+{
+	struct tree_par_s *par;
+	tree_deque_t deque;
+	size_t result;
+	unsigned int seed;
+	pthread_t thread;
+	char pad[64];
+} tree_worker_t;
+
+/**
+* struct tree_par_s - Parallel reduction shared by its workers
+*
+* @map: Function mapping a node and its depth to a value
+* @combine: Associative and commutative function combining two values
+* @identity: Value neutral for @combine
+* @cutoff: Depth from which subtrees are reduced sequentially
+* @pending: Number of tasks pushed and not finished yet
+* @count: Number of workers
+* @workers: Array of the workers
+*/
+typedef struct tree_par_s
+{
+	size_t (*map)(const binary_tree_t *, size_t);
+	size_t (*combine)(size_t, size_t);
+	size_t identity;
+	size_t cutoff;
+	size_t pending;
+	size_t count;
+	tree_worker_t *workers;
+} tree_par_t;
+
+#define TREE_VALID_BST 0
+#define TREE_VALID_AVL 1
+#define TREE_VALID_HEAP 2
+
+/**
+* struct tree_check_s - Subtree to validate by a parallel validator
+*
+* @node: Pointer to the root node of the subtree
+* @lo: Smallest value allowed in the subtree
+* @hi: Greatest value allowed in the subtree, lower than @lo if the subtree
+* must be empty
+* @index: Level-order index of @node in the whole tree, the root being 1
+* @depth: Depth of @node in the whole tree
+* @size: Height of the subtree for TREE_VALID_AVL, its number of nodes for
+* TREE_VALID_HEAP
+* @max_index: Greatest level-order index found in the subtree
+*/
+typedef struct tree_check_s
+{
+	const binary_tree_t *node;
+	int lo;
+	int hi;
+	size_t index;
+	size_t depth;
+	size_t size;
+	size_t max_index;
+} tree_check_t;
+
+/**
+* struct tree_valid_s - Parallel validation of a binary tree
+*
+* @mode: TREE_VALID_BST, TREE_VALID_AVL or TREE_VALID_HEAP
+* @tasks: Subtrees found at the cutoff depth, in preorder
+* @count: Number of tasks
+* @cutoff: Depth of the subtrees run as tasks
+* @next: Index of the next task to run
+* @failed: Set as soon as a violation is found, stopping every worker
+* @nodes: Number of nodes above the cutoff depth
+* @max_index: Greatest level-order index above the cutoff depth
+*/
+typedef struct tree_valid_s
+{
+	int mode;
+	tree_check_t *tasks;
+	size_t count;
+	size_t cutoff;
+	size_t next;
+	int failed;
+	size_t nodes;
+	size_t max_index;
+} tree_valid_t;
+
+/**
+* struct tree_print_s - State of a binary tree rendering
+*
+* @max_depth: Depth below which subtrees are elided as "(...)"
+* @depth: Depth of the current node
+* @col: Column of the current node
+* @rows: Number of lines of the rendering
+* @cols: Number of columns of each line, capped to the maximum width
+* @pos: Column and width of the last node rendered at each depth
+* @grid: Lines of the rendering, NULL while measuring
+*/
+typedef struct tree_print_s
+{
+	size_t max_depth;
+	size_t depth;
+	size_t col;
+	size_t rows;
+	size_t cols;
+	size_t *pos;
+	char *grid;
+} tree_print_t;
+
+/**
+* struct tree_walk_s - Walk over a binary tree, with a stack of the nodes
+* still to visit instead of parent pointers
+*
+* @nodes: Array of the nodes on the stack
+* @size: Number of nodes on the stack
+* @capacity: Number of nodes allocated
+* @next: Node to visit next, before those on the stack, or NULL
+*/
+typedef struct tree_walk_s
+{
+	const binary_tree_t **nodes;
+	size_t size;
+	size_t capacity;
+	const binary_tree_t *next;
+} tree_walk_t;
+
+#define TREE_IMAGE_MAGIC "BTIM"
+#define TREE_IMAGE_VERSION 1
+#define TREE_IMAGE_ORDER 0x01020304
+#define TREE_IMAGE_HEADER 16
+
+/**
+* struct tree_image_s - Read-only view of a frozen tree image
+*
+* @keys: Keys in Eytzinger order, numbered from 1: the children of slot i
+* are the slots 2i and 2i + 1
+* @count: Number of keys
+* @map: Start of the mapping to release, NULL if the caller owns the bytes
+* @size: Size of the image in bytes
+*/
+typedef struct tree_image_s
+{
+	const int *keys;
+	size_t count;
+	void *map;
+	size_t size;
+} tree_image_t;
+
+#define TREE_WAL_LOG ".log"
+#define TREE_WAL_SNAP ".snap"
+#define TREE_WAL_INSERT '+'
+#define TREE_WAL_REMOVE '-'
+#define TREE_WAL_RECORD 5
+#define TREE_WAL_BUFFER 4095
+
+/**
+* struct tree_wal_s - AVL tree made durable by a snapshot and a log of the
+* mutations applied since
+*
+* @root: Pointer to the root node of the AVL tree
+* @fd: Descriptor of the log, opened for appending
+* @log: Path of the log
+* @snap: Path of the snapshot
+* @batch: Number of mutations committed together
+* @pending: Number of mutations not committed yet
+* @used: Number of bytes in @buf
+* @buf: Records not written to the log yet, TREE_WAL_RECORD bytes each: the
+* operation then the value in little-endian order
+*/
+typedef struct tree_wal_s
+{
+	avl_t *root;
+	int fd;
+	char *log;
+	char *snap;
+	size_t batch;
+	size_t pending;
+	size_t used;
+	unsigned char buf[TREE_WAL_BUFFER];
+} tree_wal_t;
+
+/**
+* struct tree_wal_rec_s - Mutation record read back from a log
+*
+* @key: Value inserted or removed
+* @op: TREE_WAL_INSERT or TREE_WAL_REMOVE
+* @seq: Position of the record in the log
+*/
+typedef struct tree_wal_rec_s
+{
+	int key;
+	int op;
+	size_t seq;
+} tree_wal_rec_t;
+
+#define TREE_COUNTER_CYCLES 0
+#define TREE_COUNTER_INSTRUCTIONS 1
+#define TREE_COUNTER_CACHE_MISSES 2
+#define TREE_COUNTER_BRANCH_MISSES 3
+#define TREE_COUNTER_COUNT 4
+
+/**
+* struct tree_counters_s - Hardware counters of a thread
+*
+* @fd: perf_event_open descriptor of each event, -1 if unavailable
+* @total: Count of each event accumulated between starts and stops
+* @tsc: Time-stamp counter at the last start, when cycles fall back to it
+* @perf: 1 if cycles are counted by perf_event_open, 0 if by the
+* time-stamp counter
+* @inherit: 1 if the events also count the threads created after opening
+* them, 0 if some only count the thread that opened them
+*/
+typedef struct tree_counters_s
+{
+	int fd[TREE_COUNTER_COUNT];
+	unsigned long total[TREE_COUNTER_COUNT];
+	unsigned long tsc;
+	int perf;
+	int inherit;
+} tree_counters_t;
+
+#define BENCH_SORTED 0
+#define BENCH_RANDOM 1
+#define BENCH_ZIPF 2
+#define BENCH_ZIPF_S 0.99
+#define BENCH_PAIRS 1000000
+#define BENCH_CSV 0
+#define BENCH_JSON 1
+#define BENCH_JSON_NEXT 2
+
+/**
+* struct tree_bench_s - Input and timer of one benchmark run
+*
+* @keys: Keys in input order, possibly repeated
+* @sorted: Distinct keys in increasing order
+* @n: Number of keys
+* @unique: Number of distinct keys
+* @ns: Nanoseconds timed so far
+* @start: Start of the current timing
+* @sink: Accumulates results so that timed calls are not optimized out
+* @counters: Hardware counters of the timed sections, only when compiled
+* with -DTREE_COUNTERS
+*/
+typedef struct tree_bench_s
+{
+	int *keys;
+	int *sorted;
+	size_t n;
+	size_t unique;
+	double ns;
+	struct timespec start;
+	size_t sink;
+#ifdef TREE_COUNTERS
+	tree_counters_t counters;
+#endif
+} tree_bench_t;
+
+#ifdef TREE_COUNTERS
+#define BENCH_CSV_HEADER "op,input,size,ops,ns_per_op,ops_per_sec," \
+	"peak_rss_kb,cycles_per_op,instructions_per_op,cache_misses_per_op," \
+	"branch_misses_per_op,counter_source\n"
+#else
+#define BENCH_CSV_HEADER "op,input,size,ops,ns_per_op,ops_per_sec,peak_rss_kb\n"
+#endif
+
+/**
+* struct tree_bench_op_s - Operation of the benchmark harness
+*
+* @name: Name of the operation in the report
+* @run: Prepares and times the operation, returning how many were timed
+* @max_size: Largest size run, to skip quadratic operations on large inputs
+*/
+typedef struct tree_bench_op_s
+{
+	const char *name;
+	size_t (*run)(tree_bench_t *b);
+	size_t max_size;
+} tree_bench_op_t;
+
+/**
+* struct tree_stats_s - Operation counters of a thread, or their sum
+*
+* @comparisons: Three-way key comparisons, one per node visited by a
+* search, insertion or removal
+* @rotations: Left and right rotations
+* @allocations: Nodes allocated by binary_tree_node
+* @frees: Nodes freed by deletions, removals and extractions
+* @max_depth: Deepest level a node was allocated at, the root being 0
+* @rebalances: Single or double rotations restoring the balance of an AVL
+* tree
+* @next: Shard of the next thread, in the list of all shards
+*/
+typedef struct tree_stats_s
+{
+	unsigned long comparisons;
+	unsigned long rotations;
+	unsigned long allocations;
+	unsigned long frees;
+	unsigned long max_depth;
+	unsigned long rebalances;
+	struct tree_stats_s *next;
+} tree_stats_t;
+
+extern __thread tree_stats_t *tree_stats_local;
+
+#ifdef TREE_STATS
+#define TREE_STAT_SHARD() \
+	(tree_stats_local ? tree_stats_local : tree_stats_shard())
+#define TREE_STAT_ADD(field, v) do { \
+	tree_stats_t *stat_ = TREE_STAT_SHARD(); \
+	__atomic_store_n(&stat_->field, stat_->field + (v), __ATOMIC_RELAXED); \
+	} while (0)
+#define TREE_STAT_DEPTH(parent) tree_stats_depth(parent)
+#else
+#define TREE_STAT_ADD(field, v) do {} while (0)
+#define TREE_STAT_DEPTH(parent) do {} while (0)
+#endif
+
+#define STR_PREFIX 8
+#define STR_ARENA_CHUNK 65536
+#define STR_FROZEN_INTERVAL 16
+
+/**
+* struct str_node_s - Node of a string-keyed binary search tree
+*
+* @prefix: First STR_PREFIX bytes of the key, big-endian and padded with 0,
+* so that comparing prefixes as integers orders keys by their first bytes
+* @len: Length of the key
+* @key: The key, stored in the arena of the tree
+* @parent: Pointer to the parent node
+* @left: Pointer to the left child node
+* @right: Pointer to the right child node
+*/
+typedef struct str_node_s
+{
+	uint64_t prefix;
+	size_t len;
+	const char *key;
+	struct str_node_s *parent;
+	struct str_node_s *left;
+	struct str_node_s *right;
+} str_node_t;
+
+/**
+* struct str_arena_s - Chunk of memory holding the keys of a tree
+*
+* @next: Pointer to the previous chunk
+* @used: Number of bytes used in @data
+* @size: Number of bytes in @data
+* @data: The keys, NUL-terminated
+*/
+typedef struct str_arena_s
+{
+	struct str_arena_s *next;
+	size_t used;
+	size_t size;
+	char *data;
+} str_arena_t;
+
+/**
+* struct str_bst_s - String-keyed binary search tree
+*
+* @root: Pointer to the root node, NULL if empty
+* @arena: Pointer to the chunk keys are copied to
+* @size: Number of keys in the tree
+*/
+typedef struct str_bst_s
+{
+	str_node_t *root;
+	str_arena_t *arena;
+	size_t size;
+} str_bst_t;
+
+/**
+* struct str_frozen_s - Read-only sorted form of a string-keyed tree
+*
+* @data: The keys in increasing order, each as the varint length shared with
+* the previous key, the varint length of the rest, then the rest
+* @restarts: Offset in @data of every interval-th key, which shares nothing
+* @count: Number of keys
+* @blocks: Number of restarts
+* @interval: Number of keys from one restart to the next
+* @size: Number of bytes in @data
+* @max_len: Length of the longest key
+*/
+typedef struct str_frozen_s
+{
+	unsigned char *data;
+	size_t *restarts;
+	size_t count;
+	size_t blocks;
+	size_t interval;
+	size_t size;
+	size_t max_len;
+} str_frozen_t;
+
+/**
+* struct avl_map_s - Node of an AVL tree mapping its key to a value
+*
+* @node: The AVL node, holding the key in @node.n and the height of the
+* subtree in @node.priority, which AVL trees leave unused
+* @value: Value mapped to the key, right after the node in the same
+* allocation, which is aligned on a cache line so that both share one
+*/
+typedef struct avl_map_s
+{
+	avl_t node;
+	void *value;
+} avl_map_t;
+
+/**
+* struct multiset_s - Node of an AVL tree counting occurrences of its key
+*
+* @node: The AVL node, holding the key in @node.n and the height of the
+* subtree in @node.priority, as in avl_map_t
+* @count: Number of occurrences of the key
+* @total: Number of occurrences of every key in the subtree
+*/
+typedef struct multiset_s
+{
+	avl_t node;
+	size_t count;
+	size_t total;
+} multiset_t;
+
+#define TOPK_LANES 16
+
+/**
+* struct topk_s - Bounded selection of the greatest values of a stream
+*
+* @heap: Min-heap in a flat array of the values kept, the smallest at 0,
+* the children of index i at 2i + 1 and 2i + 2
+* @k: Number of values to keep
+* @size: Number of values kept so far, at most @k
+* @seen: Number of values offered
+*/
+typedef struct topk_s
+{
+	int *heap;
+	size_t k;
+	size_t size;
+	unsigned long seen;
+} topk_t;
+
+#define RB_BLACK 0
+#define RB_RED 1
+
 void binary_tree_print(const binary_tree_t *);
+char *binary_tree_render(const binary_tree_t *tree, size_t max_depth,
+	size_t max_width, size_t *len);
+int binary_tree_fprint(FILE *stream, const binary_tree_t *tree,
+	size_t max_depth, size_t max_width);
 
 /* Function Prototypes */
 /*
@@ -327,4 +1110,1768 @@ int heap_extract(heap_t **root);
  **/
 int *heap_to_sorted_array(heap_t *heap, size_t *size);
 
+/**
+* rb_rotate - rotates a red-black tree node, updating the root if it moved
+* @tree: double pointer to the root node of the red-black tree
+* @node: node to rotate around
+* @left: 1 for a left-rotation, 0 for a right-rotation
+* Return: void
+*/
+void rb_rotate(rb_t **tree, rb_t *node, int left);
+
+/**
+* rb_insert - inserts a value in a Red-Black Tree
+* @tree: double pointer to the root node of the tree to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+rb_t *rb_insert(rb_t **tree, int value);
+
+/**
+* rb_remove - removes a node from a Red-Black Tree
+* @root: pointer to the root node of the tree for removing a node
+* @value: value to remove in the tree
+* Return: pointer to the new root of the tree after removing the value
+*/
+rb_t *rb_remove(rb_t *root, int value);
+
+/**
+* binary_tree_is_rb - checks if a binary tree is a valid Red-Black Tree
+* @tree: pointer to the root node of the tree to check
+* Return: 1 if tree is a valid Red-Black Tree, and 0 otherwise
+*/
+int binary_tree_is_rb(const binary_tree_t *tree);
+
+/**
+* splay - moves a node to the root of its Splay Tree with rotations
+* @tree: double pointer to the root node of the splay tree
+* @node: node to bring to the root
+* Return: void
+*/
+void splay(splay_t **tree, splay_t *node);
+
+/**
+* splay_search - searches for a value in a Splay Tree and splays the last
+* node reached to the root
+* @tree: double pointer to the root node of the splay tree
+* @value: value to search in the tree
+* Return: pointer to the node containing value, or NULL if it is not found
+*/
+splay_t *splay_search(splay_t **tree, int value);
+
+/**
+* splay_insert - inserts a value in a Splay Tree
+* @tree: double pointer to the root node of the tree to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+splay_t *splay_insert(splay_t **tree, int value);
+
+/**
+* splay_remove - removes a node from a Splay Tree
+* @root: pointer to the root node of the tree for removing a node
+* @value: value to remove in the tree
+* Return: pointer to the new root of the tree after removing the value
+*/
+splay_t *splay_remove(splay_t *root, int value);
+
+/**
+* treap_priority - draws the next node priority of a treap
+* @treap: pointer to the treap handle owning the generator
+* Return: a pseudo-random 31-bit priority
+*/
+unsigned int treap_priority(treap_t *treap);
+
+/**
+* treap_insert - inserts a value in a Treap
+* @treap: pointer to the treap handle to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+binary_tree_t *treap_insert(treap_t *treap, int value);
+
+/**
+* treap_remove - removes a node from a Treap
+* @treap: pointer to the treap handle for removing a node
+* @value: value to remove in the treap
+* Return: pointer to the new root of the treap after removing the value
+*/
+binary_tree_t *treap_remove(treap_t *treap, int value);
+
+/**
+* treap_split - splits a Treap around a key
+* @treap: pointer to the treap handle to split, keeps the values below key
+* @key: values greater than or equal to key move to right
+* @right: pointer to an empty treap handle receiving the upper part
+* Return: pointer to the root of the upper part, or NULL if it is empty or
+* right is not empty
+*/
+binary_tree_t *treap_split(treap_t *treap, int key, treap_t *right);
+
+/**
+* treap_merge - joins two Treaps whose values do not overlap
+* @left: pointer to the treap handle with the smaller values, receives all
+* @right: pointer to the treap handle with the greater values, left empty
+* Return: pointer to the root of the merged treap
+*/
+binary_tree_t *treap_merge(treap_t *left, treap_t *right);
+
+/**
+* sorted_array_to_treap - builds a Treap from a sorted array in O(n)
+* @treap: pointer to an empty treap handle receiving the values
+* @array: pointer to the first element of the sorted array
+* @size: number of elements in the array
+* Return: pointer to the root node of the created treap, or NULL on failure
+*/
+binary_tree_t *sorted_array_to_treap(treap_t *treap, int *array, size_t size);
+
+/**
+* scapegoat_rebuild - rebuilds a Scapegoat Tree subtree to perfect balance
+* @tree: pointer to the scapegoat tree handle
+* @node: pointer to the root node of the subtree to rebuild
+* Return: pointer to the root node of the rebuilt subtree, or NULL on failure
+*/
+bst_t *scapegoat_rebuild(scapegoat_t *tree, bst_t *node);
+
+/**
+* scapegoat_insert - inserts a value in a Scapegoat Tree
+* @tree: pointer to the scapegoat tree handle to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+bst_t *scapegoat_insert(scapegoat_t *tree, int value);
+
+/**
+* scapegoat_remove - removes a node from a Scapegoat Tree
+* @tree: pointer to the scapegoat tree handle for removing a node
+* @value: value to remove in the tree
+* Return: pointer to the new root of the tree after removing the value
+*/
+bst_t *scapegoat_remove(scapegoat_t *tree, int value);
+
+/**
+* bplus_node - creates an empty B+ tree node aligned on a cache line
+* @leaf: 1 to create a leaf, 0 to create an internal node
+* Return: pointer to the new node, or NULL on failure
+*/
+bplus_t *bplus_node(int leaf);
+
+/**
+* bplus_delete - deletes an entire B+ tree
+* @tree: pointer to the root node of the tree to delete
+* Return: void
+*/
+void bplus_delete(bplus_t *tree);
+
+/**
+* bplus_child_index - finds the child of an internal node covering a value
+* @node: pointer to the internal node
+* @value: value to locate
+* Return: index of the child to descend into
+*/
+int bplus_child_index(const bplus_t *node, int value);
+
+/**
+* bplus_search - searches for a value in a B+ tree
+* @tree: pointer to the root node of the B+ tree to search
+* @value: value to search in the tree
+* Return: pointer to the leaf holding value, or NULL if it is not found
+*/
+bplus_t *bplus_search(const bplus_t *tree, int value);
+
+/**
+* bplus_insert - inserts a value in a B+ tree
+* @tree: double pointer to the root node of the B+ tree to insert the value
+* @value: value to insert in the tree
+* Return: pointer to the leaf holding the value, or NULL on failure or
+* duplicate value
+*/
+bplus_t *bplus_insert(bplus_t **tree, int value);
+
+/**
+* bplus_remove - removes a value from a B+ tree
+* @root: pointer to the root node of the tree for removing a value
+* @value: value to remove in the tree
+* Return: pointer to the new root of the tree after removing the value
+*/
+bplus_t *bplus_remove(bplus_t *root, int value);
+
+/**
+* sorted_array_to_bplus - bulk loads a B+ tree from a sorted array,
+* skipping duplicates
+* @array: pointer to the first element of the sorted array
+* @size: number of elements in the array
+* Return: pointer to the root node of the created B+ tree, or NULL on failure
+*/
+bplus_t *sorted_array_to_bplus(int *array, size_t size);
+
+/**
+* bplus_range - goes through the values of a B+ tree within a range, in order
+* @tree: pointer to the root node of the B+ tree
+* @lo: smallest value of the range
+* @hi: greatest value of the range
+* @func: pointer to a function to call for each value, may be NULL
+* Return: number of values in the range
+*/
+size_t bplus_range(const bplus_t *tree, int lo, int hi, void (*func)(int));
+
+/**
+* cpool_init - initializes an empty compact node pool
+* @pool: pointer to the pool to initialize
+* @capacity: number of nodes to reserve
+* Return: 1 on success, 0 on failure
+*/
+int cpool_init(cpool_t *pool, unsigned int capacity);
+
+/**
+* cpool_destroy - releases all the memory of a compact node pool
+* @pool: pointer to the pool to destroy
+* Return: void
+*/
+void cpool_destroy(cpool_t *pool);
+
+/**
+* cpool_node - creates a compact node, reusing released slots first
+* @pool: pointer to the pool to allocate from
+* @value: value to put in the new node
+* Return: index of the new node, or CNODE_NIL on failure
+*/
+unsigned int cpool_node(cpool_t *pool, int value);
+
+/**
+* cpool_release - gives a compact node back to its pool
+* @pool: pointer to the pool owning the node
+* @node: index of the node to release
+* Return: void
+*/
+void cpool_release(cpool_t *pool, unsigned int node);
+
+/**
+* cbst_insert - inserts a value in a compact Binary Search Tree
+* @pool: pointer to the pool holding the tree
+* @value: value to store in the node to be inserted
+* Return: index of the created node, or CNODE_NIL on failure or duplicate
+*/
+unsigned int cbst_insert(cpool_t *pool, int value);
+
+/**
+* cbst_search - searches for a value in a compact Binary Search Tree
+* @pool: pointer to the pool holding the tree
+* @value: value to search in the tree
+* Return: index of the node containing value, or CNODE_NIL if not found
+*/
+unsigned int cbst_search(const cpool_t *pool, int value);
+
+/**
+* cbst_remove - removes a node from a compact Binary Search Tree
+* @pool: pointer to the pool holding the tree
+* @value: value to remove in the tree
+* Return: index of the new root node of the tree
+*/
+unsigned int cbst_remove(cpool_t *pool, int value);
+
+/**
+* cavl_rebalance - rotates a compact AVL subtree whose balance factor is
+* out of range, keeping the stored balance factors exact
+* @pool: pointer to the pool holding the tree
+* @node: index of the root node of the subtree
+* @bf: balance factor of node, 2 or -2
+* Return: index of the new root node of the subtree
+*/
+unsigned int cavl_rebalance(cpool_t *pool, unsigned int node, int bf);
+
+/**
+* cavl_insert - inserts a value in a compact AVL tree
+* @pool: pointer to the pool holding the tree
+* @value: value to store in the node to be inserted
+* Return: index of the created node, or CNODE_NIL on failure or duplicate
+*/
+unsigned int cavl_insert(cpool_t *pool, int value);
+
+/**
+* cavl_remove - removes a node from a compact AVL tree
+* @pool: pointer to the pool holding the tree
+* @value: value to remove in the tree
+* Return: index of the new root node of the tree
+*/
+unsigned int cavl_remove(cpool_t *pool, int value);
+
+/**
+* cpool_from_tree - copies a binary tree into an empty compact node pool
+* @pool: pointer to the initialized, empty pool receiving the nodes
+* @tree: pointer to the root node of the tree to copy
+* Return: index of the root node in the pool, or CNODE_NIL on failure
+*/
+unsigned int cpool_from_tree(cpool_t *pool, const binary_tree_t *tree);
+
+/**
+* cpool_to_tree - copies a compact tree into a new binary tree
+* @pool: pointer to the pool holding the tree
+* Return: pointer to the root node of the created tree, or NULL on failure
+*/
+binary_tree_t *cpool_to_tree(const cpool_t *pool);
+
+/**
+* cheap_insert - inserts a value in a compact Max Binary Heap
+* @heap: pointer to the heap to insert the value
+* @value: value to insert in the heap
+* Return: pointer to the slot holding the value, or NULL on failure
+*/
+int *cheap_insert(cheap_t *heap, int value);
+
+/**
+* cheap_extract - extracts the root value of a compact Max Binary Heap
+* @heap: pointer to the heap
+* Return: value stored at the root, 0 on failure
+*/
+int cheap_extract(cheap_t *heap);
+
+/**
+* cheap_from_heap - copies a Max Binary Heap into a compact heap
+* @heap: pointer to the empty compact heap receiving the values
+* @tree: pointer to the root node of the heap to copy
+* Return: 1 on success, 0 on failure
+*/
+int cheap_from_heap(cheap_t *heap, const heap_t *tree);
+
+/**
+* cheap_to_heap - copies a compact heap into a new Max Binary Heap
+* @heap: pointer to the compact heap to copy
+* Return: pointer to the root node of the created heap, or NULL on failure
+*/
+heap_t *cheap_to_heap(const cheap_t *heap);
+
+/**
+* lean_tree_node - creates a parentless binary tree node
+* @value: value to put in the new node
+* Return: pointer to the new node, or NULL on failure
+*/
+lean_tree_t *lean_tree_node(int value);
+
+/**
+* lean_tree_delete - deletes an entire parentless binary tree
+* @tree: pointer to the root node of the tree to delete
+* Return: void
+*/
+void lean_tree_delete(lean_tree_t *tree);
+
+/**
+* lean_bst_insert - inserts a value in a parentless Binary Search Tree
+* @tree: double pointer to the root node of the BST to insert the value
+* @value: value to store in the node to be inserted
+* Return: pointer to the created node, or NULL on failure or duplicate value
+*/
+lean_tree_t *lean_bst_insert(lean_tree_t **tree, int value);
+
+/**
+* lean_rotate_left - performs a left-rotation on a parentless binary tree
+* @tree: pointer to the root node of the tree to rotate
+* Return: pointer to the new root node, for the caller to link in place of
+* tree
+*/
+lean_tree_t *lean_rotate_left(lean_tree_t *tree);
+
+/**
+* lean_rotate_right - performs a right-rotation on a parentless binary tree
+* @tree: pointer to the root node of the tree to rotate
+* Return: pointer to the new root node, for the caller to link in place of
+* tree
+*/
+lean_tree_t *lean_rotate_right(lean_tree_t *tree);
+
+/**
+* lean_path_push - pushes a node on a path stack
+* @path: pointer to the path
+* @node: node to push
+* Return: 1 on success, 0 on failure
+*/
+int lean_path_push(lean_path_t *path, lean_tree_t *node);
+
+/**
+* lean_path_free - releases the memory of a path stack
+* @path: pointer to the path
+* Return: void
+*/
+void lean_path_free(lean_path_t *path);
+
+/**
+* lean_bst_path - records the path from the root of a parentless BST down
+* to a value
+* @root: pointer to the root node of the BST
+* @value: value to look for
+* @path: pointer to the path receiving the nodes
+* Return: 1 if the path ends on value, 0 otherwise
+*/
+int lean_bst_path(lean_tree_t *root, int value, lean_path_t *path);
+
+/**
+* lean_tree_path - records the path from the root of a parentless binary
+* tree down to one of its nodes
+* @root: pointer to the root node of the tree
+* @node: pointer to the node to reach
+* @path: pointer to the path receiving the nodes
+* Return: 1 if node was found, 0 otherwise
+*/
+int lean_tree_path(lean_tree_t *root, const lean_tree_t *node,
+		lean_path_t *path);
+
+/**
+* lean_path_depth - measures the depth of the node ending a path
+* @path: pointer to the path
+* Return: depth of the node, or 0 if path is empty
+*/
+size_t lean_path_depth(const lean_path_t *path);
+
+/**
+* lean_path_sibling - finds the sibling of the node ending a path
+* @path: pointer to the path
+* Return: pointer to the sibling node, or NULL if the node has no sibling
+*/
+lean_tree_t *lean_path_sibling(const lean_path_t *path);
+
+/**
+* lean_path_uncle - finds the uncle of the node ending a path
+* @path: pointer to the path
+* Return: pointer to the uncle node, or NULL if the node has no uncle
+*/
+lean_tree_t *lean_path_uncle(const lean_path_t *path);
+
+/**
+* lean_paths_ancestor - finds the lowest common ancestor of the nodes ending
+* two paths from the same root
+* @first: pointer to the path of the first node
+* @second: pointer to the path of the second node
+* Return: pointer to the lowest common ancestor, or NULL if there is none
+*/
+lean_tree_t *lean_paths_ancestor(const lean_path_t *first,
+		const lean_path_t *second);
+
+/**
+* lean_from_tree - copies a binary tree into parentless nodes
+* @tree: pointer to the root node of the tree to copy
+* Return: pointer to the root node of the copy, or NULL on failure
+*/
+lean_tree_t *lean_from_tree(const binary_tree_t *tree);
+
+/**
+* lean_to_tree - copies a parentless binary tree into binary tree nodes,
+* for instance to print it with binary_tree_print
+* @tree: pointer to the root node of the tree to copy
+* Return: pointer to the root node of the copy, or NULL on failure
+*/
+binary_tree_t *lean_to_tree(const lean_tree_t *tree);
+
+/**
+* pavl_node - creates a persistent AVL node owning its two children
+* @value: value to put in the new node
+* @left: reference to the left child, released on failure
+* @right: reference to the right child, released on failure
+* Return: pointer to the new node, or NULL on failure
+*/
+pavl_t *pavl_node(int value, pavl_t *left, pavl_t *right);
+
+/**
+* pavl_retain - takes a new reference to a persistent AVL version
+* @root: pointer to the root node of the version
+* Return: root
+*/
+pavl_t *pavl_retain(pavl_t *root);
+
+/**
+* pavl_release - drops a reference to a persistent AVL version, freeing
+* the nodes no other version shares
+* @root: pointer to the root node of the version
+* Return: void
+*/
+void pavl_release(pavl_t *root);
+
+/**
+* pavl_make - creates a persistent AVL node over two subtrees, rotating
+* if their heights differ by two
+* @value: value to put in the node
+* @left: reference to the left subtree, consumed
+* @right: reference to the right subtree, consumed
+* Return: pointer to the root node of the balanced subtree, or NULL on
+* failure
+*/
+pavl_t *pavl_make(int value, pavl_t *left, pavl_t *right);
+
+/**
+* pavl_search - searches for a value in a persistent AVL version
+* @root: pointer to the root node of the version
+* @value: value to search in the tree
+* Return: pointer to the node containing value, or NULL if it is not found
+*/
+const pavl_t *pavl_search(const pavl_t *root, int value);
+
+/**
+* pavl_insert - creates a new persistent AVL version holding one more value
+* @root: pointer to the root node of the version to start from, unchanged
+* @value: value to insert
+* Return: reference to the root of the new version, or NULL on failure or
+* if value is already in the tree
+*/
+pavl_t *pavl_insert(pavl_t *root, int value);
+
+/**
+* pavl_remove - creates a new persistent AVL version without a value
+* @root: pointer to the root node of the version to start from, unchanged
+* @value: value to remove
+* Return: reference to the root of the new version (a new reference to root
+* if value is not in the tree), or NULL if the new version is empty or on
+* failure
+*/
+pavl_t *pavl_remove(pavl_t *root, int value);
+
+/**
+* pavl_to_tree - copies a persistent AVL version into binary tree nodes
+* @root: pointer to the root node of the version
+* Return: pointer to the root node of the copy, or NULL on failure
+*/
+binary_tree_t *pavl_to_tree(const pavl_t *root);
+
+/**
+* tree_handle_create - creates a thread-safe handle on an AVL tree
+* @root: pointer to the root node of the tree, owned by the handle
+* Return: pointer to the new handle, or NULL on failure
+*/
+tree_handle_t *tree_handle_create(avl_t *root);
+
+/**
+* tree_handle_delete - deletes a tree handle and its tree
+* @handle: pointer to the handle, with no thread left using it
+* Return: void
+*/
+void tree_handle_delete(tree_handle_t *handle);
+
+/**
+* tree_handle_enter - starts a read of a tree handle
+* @handle: pointer to the handle
+* @reader: slot of the calling thread, below TREE_READERS
+* Return: void
+*/
+void tree_handle_enter(tree_handle_t *handle, int reader);
+
+/**
+* tree_handle_leave - ends a read of a tree handle
+* @handle: pointer to the handle
+* @reader: slot of the calling thread
+* Return: void
+*/
+void tree_handle_leave(tree_handle_t *handle, int reader);
+
+/**
+* tree_handle_search - searches for a value through a tree handle
+* @handle: pointer to the handle
+* @reader: slot of the calling thread, below TREE_READERS
+* @value: value to search in the tree
+* Return: 1 if the value is in the tree, 0 otherwise
+*/
+int tree_handle_search(tree_handle_t *handle, int reader, int value);
+
+/**
+* tree_handle_range - goes through the values of a tree handle within a
+* range, in order
+* @handle: pointer to the handle
+* @reader: slot of the calling thread, below TREE_READERS
+* @lo: smallest value of the range
+* @hi: greatest value of the range
+* @func: pointer to a function to call for each value, or NULL
+* Return: number of values in the range
+*/
+size_t tree_handle_range(tree_handle_t *handle, int reader, int lo, int hi,
+	void (*func)(int));
+
+/**
+* tree_handle_insert - inserts a value through a tree handle
+* @handle: pointer to the handle
+* @value: value to insert
+* Return: 1 if the value was inserted, 0 if it was already there or on
+* failure
+*/
+int tree_handle_insert(tree_handle_t *handle, int value);
+
+/**
+* tree_handle_remove - removes a value through a tree handle
+* @handle: pointer to the handle
+* @value: value to remove
+* Return: 1 if the value was removed, 0 if it was not in the tree
+*/
+int tree_handle_remove(tree_handle_t *handle, int value);
+
+/**
+* conc_node - creates a concurrent BST node
+* @value: value to put in the new node
+* @leaf: 1 to create a leaf, 0 to create an internal node
+* @inf: 0 for a real value, 1 or 2 for a sentinel key
+* Return: pointer to the new node, or NULL on failure
+*/
+conc_node_t *conc_node(int value, int leaf, int inf);
+
+/**
+* conc_bst_create - creates an empty concurrent BST
+* Return: pointer to the new tree, or NULL on failure
+*/
+conc_bst_t *conc_bst_create(void);
+
+/**
+* conc_bst_delete - deletes a concurrent BST and its retired nodes
+* @tree: pointer to the tree, with no thread left using it
+* Return: void
+*/
+void conc_bst_delete(conc_bst_t *tree);
+
+/**
+* conc_enter - starts an operation of a thread on a concurrent BST
+* @tree: pointer to the tree
+* @thread: index of the calling thread, below CONC_THREADS
+* Return: void
+*/
+void conc_enter(conc_bst_t *tree, int thread);
+
+/**
+* conc_leave - ends an operation of a thread on a concurrent BST
+* @tree: pointer to the tree
+* @thread: index of the calling thread
+* Return: void
+*/
+void conc_leave(conc_bst_t *tree, int thread);
+
+/**
+* conc_retire - hands an unlinked node over to epoch-based reclamation
+* @tree: pointer to the tree
+* @thread: index of the calling thread, inside the tree
+* @node: pointer to the unlinked node
+* Return: void
+*/
+void conc_retire(conc_bst_t *tree, int thread, conc_node_t *node);
+
+/**
+* conc_lock - takes the spin lock of a concurrent BST node
+* @node: pointer to the node
+* @try: 1 to give up at once if the lock is taken
+* Return: 1 if the lock was taken, 0 otherwise
+*/
+int conc_lock(conc_node_t *node, int try);
+
+/**
+* conc_unlock - releases the spin lock of a concurrent BST node
+* @node: pointer to the node
+* Return: void
+*/
+void conc_unlock(conc_node_t *node);
+
+/**
+* conc_link - replaces a child of a locked node if it is still in the tree
+* @node: pointer to the locked node
+* @old: pointer to the child expected
+* @new: pointer to the child to put in its place
+* Return: 1 if the child was replaced, 0 if the tree changed meanwhile
+*/
+int conc_link(conc_node_t *node, conc_node_t *old, conc_node_t *new);
+
+/**
+* conc_bst_find - goes down a concurrent BST to the leaf a value leads to
+* @tree: pointer to the tree
+* @value: value to look for
+* @path: filled with the grandparent, the parent and the leaf
+* Return: void
+*/
+void conc_bst_find(conc_bst_t *tree, int value, conc_node_t **path);
+
+/**
+* conc_bst_search - searches for a value in a concurrent BST, without locks
+* @tree: pointer to the tree
+* @thread: index of the calling thread, below CONC_THREADS
+* @value: value to search in the tree
+* Return: 1 if the value is in the tree, 0 otherwise
+*/
+int conc_bst_search(conc_bst_t *tree, int thread, int value);
+
+/**
+* conc_bst_insert - inserts a value in a concurrent BST
+* @tree: pointer to the tree
+* @thread: index of the calling thread, below CONC_THREADS
+* @value: value to insert
+* Return: 1 if the value was inserted, 0 if it was already there or on
+* failure
+*/
+int conc_bst_insert(conc_bst_t *tree, int thread, int value);
+
+/**
+* conc_bst_remove - removes a value from a concurrent BST
+* @tree: pointer to the tree
+* @thread: index of the calling thread, below CONC_THREADS
+* @value: value to remove
+* Return: 1 if the value was removed, 0 if it was not in the tree
+*/
+int conc_bst_remove(conc_bst_t *tree, int thread, int value);
+
+/**
+* mq_create - creates an empty MultiQueue
+* @count: number of sub-queues, twice the number of threads is a good start
+* Return: pointer to the new queue, or NULL on failure
+*/
+mq_t *mq_create(size_t count);
+
+/**
+* mq_delete - deletes a MultiQueue
+* @mq: pointer to the queue, with no thread left using it
+* Return: void
+*/
+void mq_delete(mq_t *mq);
+
+/**
+* mq_random - draws a random sub-queue of a MultiQueue
+* @mq: pointer to the queue
+* @seed: xorshift state owned by the calling thread
+* Return: pointer to the sub-queue
+*/
+mq_queue_t *mq_random(mq_t *mq, unsigned int *seed);
+
+/**
+* mq_trylock - takes the lock of a MultiQueue sub-queue if it is free
+* @queue: pointer to the sub-queue
+* Return: 1 if the lock was taken, 0 otherwise
+*/
+int mq_trylock(mq_queue_t *queue);
+
+/**
+* mq_unlock - publishes the top of a MultiQueue sub-queue and releases it
+* @queue: pointer to the locked sub-queue
+* Return: void
+*/
+void mq_unlock(mq_queue_t *queue);
+
+/**
+* mq_insert - inserts a value in a MultiQueue
+* @mq: pointer to the queue
+* @seed: xorshift state owned by the calling thread
+* @value: value to insert
+* Return: 1 on success, 0 on failure
+*/
+int mq_insert(mq_t *mq, unsigned int *seed, int value);
+
+/**
+* mq_extract - extracts one of the greatest values of a MultiQueue
+* @mq: pointer to the queue
+* @seed: xorshift state owned by the calling thread
+* @value: address where to store the value extracted
+* Return: 1 if a value was extracted, 0 if the queue looked empty
+*/
+int mq_extract(mq_t *mq, unsigned int *seed, int *value);
+
+/**
+* tree_deque_push - pushes a task at the tail of a worker deque
+* @deque: pointer to the deque
+* @node: pointer to the root node of the subtree
+* @depth: depth of node in the whole tree
+* Return: 1 on success, 0 on failure
+*/
+int tree_deque_push(tree_deque_t *deque, const binary_tree_t *node,
+	size_t depth);
+
+/**
+* tree_deque_pop - pops the newest task of a worker deque
+* @deque: pointer to the deque
+* @task: address where to store the task
+* Return: 1 if a task was popped, 0 if the deque is empty
+*/
+int tree_deque_pop(tree_deque_t *deque, tree_task_t *task);
+
+/**
+* tree_deque_steal - steals the oldest task of a worker deque
+* @deque: pointer to the deque
+* @task: address where to store the task
+* Return: 1 if a task was stolen, 0 if the deque is empty
+*/
+int tree_deque_steal(tree_deque_t *deque, tree_task_t *task);
+
+/**
+* tree_par_threads - sets the number of threads of the parallel reductions
+* @threads: number of threads, or 0 to keep the current one
+* Return: number of threads in use, the online processors by default
+*/
+size_t tree_par_threads(size_t threads);
+
+/**
+* tree_par_walk - reduces a subtree sequentially, in preorder
+* @par: pointer to the reduction
+* @top: pointer to the root node of the subtree
+* @depth: depth of top in the whole tree
+* Return: combination of the values mapped from the subtree
+*/
+size_t tree_par_walk(const tree_par_t *par, const binary_tree_t *top,
+	size_t depth);
+
+/**
+* tree_par_reduce - maps every node of a binary tree and combines the
+* values, on a pool of work-stealing threads
+* @tree: pointer to the root node of the tree
+* @map: function mapping a node and its depth to a value
+* @combine: associative and commutative function combining two values
+* @identity: value neutral for combine
+* Return: combination of the values mapped from every node, identity if
+* tree is NULL
+*/
+size_t tree_par_reduce(const binary_tree_t *tree,
+	size_t (*map)(const binary_tree_t *, size_t),
+	size_t (*combine)(size_t, size_t), size_t identity);
+
+/**
+* tree_par_sum - adds two counts
+* @a: first count
+* @b: second count
+* Return: a + b
+*/
+size_t tree_par_sum(size_t a, size_t b);
+
+/**
+* binary_tree_par_size - measures the size of a binary tree in parallel
+* @tree: pointer to the root node of the tree to measure the size
+* Return: size of the tree, 0 if tree is NULL
+*/
+size_t binary_tree_par_size(const binary_tree_t *tree);
+
+/**
+* binary_tree_par_leaves - counts the leaves in a binary tree in parallel
+* @tree: pointer to the root node of the tree to count the leaves
+* Return: number of leaves, 0 if tree is NULL
+*/
+size_t binary_tree_par_leaves(const binary_tree_t *tree);
+
+/**
+* binary_tree_par_nodes - counts the nodes with at least 1 child in a
+* binary tree in parallel
+* @tree: pointer to the root node of the tree to count the nodes
+* Return: number of nodes, 0 if tree is NULL
+*/
+size_t binary_tree_par_nodes(const binary_tree_t *tree);
+
+/**
+* binary_tree_par_height - measures the height of a binary tree in parallel
+* @tree: pointer to the root node of the tree to measure the height
+* Return: height of the tree, 0 if tree is NULL
+*/
+size_t binary_tree_par_height(const binary_tree_t *tree);
+
+/**
+* tree_valid_run - validates a binary tree in parallel
+* @tree: pointer to the root node of the tree, not NULL
+* @mode: TREE_VALID_BST, TREE_VALID_AVL or TREE_VALID_HEAP
+* @valid: pointer to the validation to fill, its tasks to free by the caller
+* Return: 1 if every subtree is valid, 0 if one is not, -1 on failure
+*/
+int tree_valid_run(const binary_tree_t *tree, int mode, tree_valid_t *valid);
+
+/**
+* tree_valid_task - validates one subtree task with the checker of the mode
+* @valid: pointer to the validation
+* @task: pointer to the task
+* Return: 1 if the subtree is valid, 0 otherwise
+*/
+int tree_valid_task(tree_valid_t *valid, tree_check_t *task);
+
+/**
+* tree_valid_cancelled - checks every 1024 calls whether to stop a task
+* @valid: pointer to the validation
+* @seen: pointer to the number of nodes the task went through
+* Return: 1 if another worker found a violation, 0 otherwise
+*/
+int tree_valid_cancelled(tree_valid_t *valid, size_t *seen);
+
+/**
+* tree_valid_bst - checks that every value of a subtree lies within the
+* bounds its ancestors set
+* @valid: pointer to the validation
+* @task: pointer to the subtree task
+* Return: 1 if the subtree is valid, 0 otherwise
+*/
+int tree_valid_bst(tree_valid_t *valid, tree_check_t *task);
+
+/**
+* tree_valid_avl - checks that a subtree is an AVL tree within its bounds
+* @valid: pointer to the validation
+* @task: pointer to the subtree task, whose size is set to its height
+* Return: 1 if the subtree is valid, 0 otherwise
+*/
+int tree_valid_avl(tree_valid_t *valid, tree_check_t *task);
+
+/**
+* tree_valid_heap - checks that a subtree is a Max Binary Heap, counting
+* its nodes and its greatest level-order index
+* @valid: pointer to the validation
+* @task: pointer to the subtree task
+* Return: 1 if the subtree is valid, 0 otherwise
+*/
+int tree_valid_heap(tree_valid_t *valid, tree_check_t *task);
+
+/**
+* binary_tree_par_is_bst - checks in parallel if a binary tree is a valid
+* Binary Search Tree
+* @tree: pointer to the root node of the tree to check
+* Return: 1 if tree is a valid BST, and 0 otherwise
+*/
+int binary_tree_par_is_bst(const binary_tree_t *tree);
+
+/**
+* binary_tree_par_is_avl - checks in parallel if a binary tree is a valid
+* AVL Tree
+* @tree: pointer to the root node of the tree to check
+* Return: 1 if tree is a valid AVL Tree, and 0 otherwise
+*/
+int binary_tree_par_is_avl(const binary_tree_t *tree);
+
+/**
+* binary_tree_par_is_heap - checks in parallel if a binary tree is a valid
+* Max Binary Heap
+* @tree: pointer to the root node of the tree to check
+* Return: 1 if tree is a valid Max Binary Heap, and 0 otherwise
+*/
+int binary_tree_par_is_heap(const binary_tree_t *tree);
+
+#define TREE_SERIAL_MAGIC "BTRE"
+#define TREE_SERIAL_VERSION 1
+#define TREE_SERIAL_VARINT 1
+#define TREE_SERIAL_DELTA 2
+
+/**
+* tree_write_varint - writes an unsigned integer as a varint
+* @stream: stream to write to
+* @value: integer to write
+* Return: 0 on success, -1 on failure
+*/
+int tree_write_varint(FILE *stream, unsigned long value);
+
+/**
+* tree_read_varint - reads an unsigned integer written as a varint
+* @stream: stream to read from
+* @value: where to store the integer
+* Return: 0 on success, -1 on failure
+*/
+int tree_read_varint(FILE *stream, unsigned long *value);
+
+/**
+* tree_write_key - writes a key of a serialized tree
+* @stream: stream to write to
+* @key: key to write
+* @prev: previous key written
+* @flags: encodings in use
+* Return: 0 on success, -1 on failure
+*/
+int tree_write_key(FILE *stream, int key, int prev, int flags);
+
+/**
+* tree_read_key - reads a key of a serialized tree
+* @stream: stream to read from
+* @key: where to store the key
+* @prev: previous key read
+* @flags: encodings in use
+* Return: 0 on success, -1 on failure
+*/
+int tree_read_key(FILE *stream, int *key, int prev, int flags);
+
+/**
+* tree_preorder_next - finds the next node of a subtree in preorder
+* @node: pointer to the current node
+* @top: pointer to the root node of the subtree
+* Return: pointer to the next node, or NULL after the last one
+*/
+const binary_tree_t *tree_preorder_next(const binary_tree_t *node,
+	const binary_tree_t *top);
+
+/**
+* tree_inorder_first - finds the first node of a subtree in in-order
+* @node: pointer to the root node of the subtree
+* Return: pointer to the leftmost node of the subtree
+*/
+const binary_tree_t *tree_inorder_first(const binary_tree_t *node);
+
+/**
+* tree_inorder_next - finds the next node of a subtree in in-order
+* @node: pointer to the current node
+* @top: pointer to the root node of the subtree
+* Return: pointer to the next node, or NULL after the last one
+*/
+const binary_tree_t *tree_inorder_next(const binary_tree_t *node,
+	const binary_tree_t *top);
+
+/**
+* tree_walk_push - pushes a node on the stack of a walk
+* @walk: pointer to the walk
+* @node: node to push
+* Return: 0 on success, -1 on failure
+*/
+int tree_walk_push(tree_walk_t *walk, const binary_tree_t *node);
+
+/**
+* tree_walk_start - starts a walk over a tree, reusing its stack
+* @walk: pointer to the walk
+* @tree: pointer to the root node of the tree, may be NULL
+* Return: void
+*/
+void tree_walk_start(tree_walk_t *walk, const binary_tree_t *tree);
+
+/**
+* tree_walk_preorder - moves a walk to its next node in preorder
+* @walk: pointer to the walk
+* @node: set to the next node
+* Return: 1 if a node was found, 0 after the last one, -1 on failure
+*/
+int tree_walk_preorder(tree_walk_t *walk, const binary_tree_t **node);
+
+/**
+* tree_walk_inorder - moves a walk to its next node in in-order
+* @walk: pointer to the walk
+* @node: set to the next node
+* Return: 1 if a node was found, 0 after the last one, -1 on failure
+*/
+int tree_walk_inorder(tree_walk_t *walk, const binary_tree_t **node);
+
+/**
+* tree_walk_count - counts the nodes of a tree
+* @walk: pointer to the walk, whose stack is reused
+* @tree: pointer to the root node of the tree, may be NULL
+* @count: set to the number of nodes
+* Return: 0 on success, -1 on failure
+*/
+int tree_walk_count(tree_walk_t *walk, const binary_tree_t *tree,
+	size_t *count);
+
+/**
+* tree_write_shape - writes the shape of a tree as a preorder bitmap
+* @stream: stream to write to
+* @tree: pointer to the root node of the tree
+* @walk: pointer to the walk whose stack is reused
+* Return: 0 on success, -1 on failure
+*/
+int tree_write_shape(FILE *stream, const binary_tree_t *tree,
+	tree_walk_t *walk);
+
+/**
+* tree_write_keys - writes the keys of a tree in in-order
+* @stream: stream to write to
+* @tree: pointer to the root node of the tree
+* @flags: encodings in use
+* @walk: pointer to the walk whose stack is reused
+* Return: 0 on success, -1 on failure
+*/
+int tree_write_keys(FILE *stream, const binary_tree_t *tree, int flags,
+	tree_walk_t *walk);
+
+/**
+* binary_tree_save - serializes a binary tree, AVL tree or heap
+* @stream: stream to write to
+* @tree: pointer to the root node of the tree, may be NULL
+* @flags: TREE_SERIAL_VARINT or TREE_SERIAL_DELTA to compress the keys
+* Return: 0 on success, -1 on failure
+*/
+int binary_tree_save(FILE *stream, const binary_tree_t *tree, int flags);
+
+/**
+* tree_shape_next - finds where the next node of a shape bitmap goes
+* @node: pointer to the node just created
+* @side: set to 1, the next node being a right child
+* Return: pointer to the parent of the next node, or NULL if the shape is
+* complete
+*/
+binary_tree_t *tree_shape_next(binary_tree_t *node, int *side);
+
+/**
+* tree_read_shape - rebuilds the nodes of a tree from its shape bitmap
+* @stream: stream to read from
+* @count: number of nodes
+* Return: pointer to the root node of the tree, or NULL on failure
+*/
+binary_tree_t *tree_read_shape(FILE *stream, unsigned long count);
+
+/**
+* binary_tree_load - deserializes a tree written by binary_tree_save
+* @stream: stream to read from
+* @tree: where to store the pointer to the root node of the tree
+* Return: 0 on success, -1 on failure
+*/
+int binary_tree_load(FILE *stream, binary_tree_t **tree);
+
+/**
+* tree_image_first - finds the first slot of an Eytzinger array in order
+* @count: number of keys, at least 1
+* Return: index of the leftmost slot
+*/
+size_t tree_image_first(size_t count);
+
+/**
+* tree_image_next - finds the next slot of an Eytzinger array in order
+* @i: index of the current slot
+* @count: number of keys
+* Return: index of the next slot, or 0 after the last one
+*/
+size_t tree_image_next(size_t i, size_t count);
+
+/**
+* tree_image_fill - places the keys of a tree in Eytzinger order
+* @tree: pointer to the root node of the tree, not NULL
+* @keys: array of count keys to fill
+* @count: number of nodes of the tree
+* @walk: pointer to the walk whose stack is reused
+* Return: 0 on success, -1 on failure or if the tree does not hold
+* exactly count nodes
+*/
+int tree_image_fill(const bst_t *tree, int *keys, size_t count,
+	tree_walk_t *walk);
+
+/**
+* tree_image_write - writes the frozen image of a Binary Search Tree
+* @stream: stream to write to
+* @tree: pointer to the root node of the BST or AVL tree, may be NULL
+* Return: 0 on success, -1 on failure
+*/
+int tree_image_write(FILE *stream, const bst_t *tree);
+
+/**
+* tree_image_map - checks a tree image in memory and points an image at it
+* @bytes: pointer to the image, aligned on an int
+* @size: size of the image in bytes
+* @image: image to set up
+* Return: 0 on success, -1 if the bytes are not a valid image
+*/
+int tree_image_map(const void *bytes, size_t size, tree_image_t *image);
+
+/**
+* tree_image_open - maps a tree image file read-only
+* @path: path of the file written by tree_image_write
+* @image: image to set up
+* Return: 0 on success, -1 on failure
+*/
+int tree_image_open(const char *path, tree_image_t *image);
+
+/**
+* tree_image_close - unmaps a tree image opened by tree_image_open
+* @image: image to close
+*/
+void tree_image_close(tree_image_t *image);
+
+/**
+* tree_image_lower - finds the slot of the smallest key of a tree image
+* greater than or equal to a value
+* @image: pointer to the image
+* @value: value to look for
+* Return: index of the slot, or 0 if every key is smaller
+*/
+size_t tree_image_lower(const tree_image_t *image, int value);
+
+/**
+* tree_image_search - searches for a value in a tree image
+* @image: pointer to the image
+* @value: value to search
+* Return: 1 if the value is in the image, 0 otherwise
+*/
+int tree_image_search(const tree_image_t *image, int value);
+
+/**
+* tree_image_floor - finds the greatest key of a tree image lower than or
+* equal to a value
+* @image: pointer to the image
+* @value: value to look for
+* @floor: where to store the key found
+* Return: 1 if such a key exists, 0 otherwise
+*/
+int tree_image_floor(const tree_image_t *image, int value, int *floor);
+
+/**
+* tree_image_range - goes through the keys of a tree image within a range
+* @image: pointer to the image
+* @lo: smallest value of the range
+* @hi: greatest value of the range
+* @func: pointer to a function to call for each key, may be NULL
+* Return: number of keys in the range
+*/
+size_t tree_image_range(const tree_image_t *image, int lo, int hi,
+	void (*func)(int));
+
+/**
+* tree_wal_path - builds the path of a file of a logged tree
+* @path: base path of the tree
+* @suffix: suffix of the file
+* Return: the path, to be freed, or NULL on failure
+*/
+char *tree_wal_path(const char *path, const char *suffix);
+
+/**
+* tree_wal_load - loads the snapshot of a logged tree, if there is one
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_load(tree_wal_t *wal);
+
+/**
+* tree_wal_open - opens a durable AVL tree, recovering it from its snapshot
+* and its mutation log
+* @path: base path of the tree
+* @batch: number of mutations committed together
+* Return: pointer to the logged tree, or NULL on failure
+*/
+tree_wal_t *tree_wal_open(const char *path, size_t batch);
+
+/**
+* tree_wal_close - commits the pending mutations of a logged tree and
+* releases it
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 if the last mutations could not be committed
+*/
+int tree_wal_close(tree_wal_t *wal);
+
+/**
+* tree_wal_flush - writes the buffered records of a logged tree to its log
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_flush(tree_wal_t *wal);
+
+/**
+* tree_wal_commit - makes every mutation of a logged tree durable
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_commit(tree_wal_t *wal);
+
+/**
+* tree_wal_append - buffers a mutation record of a logged tree
+* @wal: pointer to the logged tree
+* @op: TREE_WAL_INSERT or TREE_WAL_REMOVE
+* @value: value inserted or removed
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_append(tree_wal_t *wal, int op, int value);
+
+/**
+* tree_wal_insert - inserts a value in a logged tree
+* @wal: pointer to the logged tree
+* @value: value to insert
+* Return: pointer to the created node, or NULL if the value is already
+* present or on failure
+*/
+avl_t *tree_wal_insert(tree_wal_t *wal, int value);
+
+/**
+* tree_wal_remove - removes a value from a logged tree
+* @wal: pointer to the logged tree
+* @value: value to remove
+* Return: 1 if the value was removed, 0 if it is absent, -1 on failure
+*/
+int tree_wal_remove(tree_wal_t *wal, int value);
+
+/**
+* tree_wal_cmp - orders mutation records by value, then by log position
+* @a: pointer to the first record
+* @b: pointer to the second record
+* Return: negative, zero or positive as a sorts before, with or after b
+*/
+int tree_wal_cmp(const void *a, const void *b);
+
+/**
+* tree_wal_read - reads the records of the log of a logged tree
+* @wal: pointer to the logged tree
+* @count: set to the number of records
+* Return: the records, to be freed, or NULL on failure
+*/
+tree_wal_rec_t *tree_wal_read(tree_wal_t *wal, size_t *count);
+
+/**
+* tree_wal_merge - merges the values of a tree with sorted mutations
+* @root: pointer to the root node of the tree
+* @recs: records sorted by tree_wal_cmp
+* @count: number of records
+* @keys: array receiving the resulting values, in order
+* Return: number of resulting values
+*/
+size_t tree_wal_merge(const avl_t *root, const tree_wal_rec_t *recs,
+	size_t count, int *keys);
+
+/**
+* tree_wal_replay - applies the log of a logged tree to its snapshot
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_replay(tree_wal_t *wal);
+
+/**
+* tree_wal_sync_dir - syncs the directory holding a file
+* @path: path of the file
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_sync_dir(const char *path);
+
+/**
+* tree_wal_checkpoint - writes a snapshot of a logged tree and empties its
+* log
+* @wal: pointer to the logged tree
+* Return: 0 on success, -1 on failure
+*/
+int tree_wal_checkpoint(tree_wal_t *wal);
+
+/**
+* bench_random - draws a pseudo-random number with a xorshift generator
+* @state: state of the generator, not 0
+* Return: the number
+*/
+unsigned long bench_random(unsigned long *state);
+
+/**
+* bench_cmp - orders two integers
+* @a: pointer to the first integer
+* @b: pointer to the second integer
+* Return: negative, zero or positive as a is lower, equal or greater
+*/
+int bench_cmp(const void *a, const void *b);
+
+/**
+* bench_zipf - draws the rank of a key from a Zipf distribution
+* @state: state of the generator
+* @n: number of ranks
+* Return: a rank between 1 and n
+*/
+size_t bench_zipf(unsigned long *state, size_t n);
+
+/**
+* bench_input - generates the keys of a benchmark
+* @b: pointer to the benchmark, whose size is set
+* @input: BENCH_SORTED, BENCH_RANDOM or BENCH_ZIPF
+* Return: 0 on success, -1 on failure
+*/
+int bench_input(tree_bench_t *b, int input);
+
+/**
+* bench_insert - times avl_insert on every key of a benchmark
+* @b: pointer to the benchmark
+* Return: number of operations timed
+*/
+size_t bench_insert(tree_bench_t *b);
+
+/**
+* bench_search - times bst_search on every key of a benchmark
+* @b: pointer to the benchmark
+* Return: number of operations timed
+*/
+size_t bench_search(tree_bench_t *b);
+
+/**
+* bench_remove - times avl_remove on every key of a benchmark
+* @b: pointer to the benchmark
+* Return: number of operations timed
+*/
+size_t bench_remove(tree_bench_t *b);
+
+/**
+* bench_visit - visits a value during a timed traversal
+* @value: value visited, unused
+*/
+void bench_visit(int value);
+
+/**
+* bench_inorder - times binary_tree_inorder over the keys of a benchmark
+* @b: pointer to the benchmark
+* Return: number of nodes visited
+*/
+size_t bench_inorder(tree_bench_t *b);
+
+/**
+* bench_is_bst - times binary_tree_is_bst over the keys of a benchmark
+* @b: pointer to the benchmark
+* Return: number of nodes checked
+*/
+size_t bench_is_bst(tree_bench_t *b);
+
+/**
+* bench_is_avl - times binary_tree_par_is_avl over the keys of a benchmark
+* @b: pointer to the benchmark
+* Return: number of nodes checked
+*/
+size_t bench_is_avl(tree_bench_t *b);
+
+/**
+* bench_heap_build - times array_to_heap on the keys of a benchmark
+* @b: pointer to the benchmark
+* Return: number of keys inserted
+*/
+size_t bench_heap_build(tree_bench_t *b);
+
+/**
+* bench_heap_extract - times heap_extract until a heap is empty
+* @b: pointer to the benchmark
+* Return: number of keys extracted
+*/
+size_t bench_heap_extract(tree_bench_t *b);
+
+/**
+* bench_lca - times binary_trees_ancestor on random pairs of nodes
+* @b: pointer to the benchmark
+* Return: number of pairs looked up
+*/
+size_t bench_lca(tree_bench_t *b);
+
+/**
+* bench_start - starts the timer of a benchmark
+* @b: pointer to the benchmark
+*/
+void bench_start(tree_bench_t *b);
+
+/**
+* bench_stop - stops the timer of a benchmark, adding the time elapsed
+* @b: pointer to the benchmark
+*/
+void bench_stop(tree_bench_t *b);
+
+/**
+* bench_report - prints the result of a benchmark as CSV or JSON
+* @op: operation benchmarked
+* @input: BENCH_SORTED, BENCH_RANDOM or BENCH_ZIPF
+* @b: pointer to the benchmark
+* @ops: number of operations timed
+* @format: BENCH_CSV, BENCH_JSON, or BENCH_JSON_NEXT after the first row
+*/
+void bench_report(const tree_bench_op_t *op, int input, const tree_bench_t *b,
+	size_t ops, int format);
+
+/**
+* bench_run - runs a benchmark in a child process
+* @op: operation to benchmark
+* @input: BENCH_SORTED, BENCH_RANDOM or BENCH_ZIPF
+* @n: number of keys
+* @format: BENCH_CSV, BENCH_JSON, or BENCH_JSON_NEXT after the first row
+* Return: 0 on success, -1 on failure
+*/
+int bench_run(const tree_bench_op_t *op, int input, size_t n, int format);
+
+/**
+* tree_counters_tsc - reads the time-stamp counter, or a nanosecond clock
+* where there is none
+* Return: the counter
+*/
+unsigned long tree_counters_tsc(void);
+
+/**
+* tree_counters_open - opens the hardware counters of the calling thread
+* and of the threads it creates afterwards
+* @c: counters to open
+* Return: 1 if perf_event_open gave the cycle counter, 0 otherwise
+*/
+int tree_counters_open(tree_counters_t *c);
+
+/**
+* tree_counters_start - starts counting
+* @c: counters opened by tree_counters_open
+*/
+void tree_counters_start(tree_counters_t *c);
+
+/**
+* tree_counters_stop - stops counting, adding the counts to the totals
+* @c: counters started by tree_counters_start
+*/
+void tree_counters_stop(tree_counters_t *c);
+
+/**
+* tree_counters_close - closes the hardware counters
+* @c: counters opened by tree_counters_open
+*/
+void tree_counters_close(tree_counters_t *c);
+
+#ifdef TREE_COUNTERS
+/**
+* bench_report_counters - prints the hardware counters of a benchmark
+* @b: pointer to the benchmark
+* @ops: number of operations timed
+* @format: BENCH_CSV, BENCH_JSON or BENCH_JSON_NEXT
+*/
+void bench_report_counters(const tree_bench_t *b, size_t ops, int format);
+#endif
+
+/**
+* tree_stats_shard - gives the counters of the calling thread, creating and
+* registering them on first use
+* Return: pointer to the counters of the thread
+*/
+tree_stats_t *tree_stats_shard(void);
+
+/**
+* tree_stats_depth - records the depth of a node about to be allocated
+* @parent: parent of the node, NULL for a root
+*/
+void tree_stats_depth(const binary_tree_t *parent);
+
+/**
+* tree_stats_snapshot - sums the counters of every thread
+* @stats: filled with the sums, and the deepest level seen by any thread
+*/
+void tree_stats_snapshot(tree_stats_t *stats);
+
+/**
+* str_prefix - packs the first bytes of a key into an integer
+* @key: NUL-terminated key
+* @len: set to the length of the key
+* Return: the first STR_PREFIX bytes, big-endian and padded with 0
+*/
+uint64_t str_prefix(const char *key, size_t *len);
+
+/**
+* str_key_cmp - compares a key with the key of a node
+* @prefix: prefix of the key, from str_prefix
+* @key: the key
+* @len: length of the key
+* @node: pointer to the node
+* Return: negative, 0 or positive as the key sorts before, equal to or after
+* the key of the node
+*/
+int str_key_cmp(uint64_t prefix, const char *key, size_t len,
+	const str_node_t *node);
+
+/**
+* str_arena_copy - copies a key into the arena of a tree
+* @tree: pointer to the tree
+* @key: key to copy
+* @len: length of the key
+* Return: pointer to the copy, or NULL on failure
+*/
+char *str_arena_copy(str_bst_t *tree, const char *key, size_t len);
+
+/**
+* str_bst_search - searches for a key in a string-keyed tree
+* @tree: pointer to the tree
+* @key: key to search for
+* Return: pointer to the node holding the key, or NULL
+*/
+str_node_t *str_bst_search(const str_bst_t *tree, const char *key);
+
+/**
+* str_bst_insert - inserts a key in a string-keyed tree
+* @tree: pointer to the tree
+* @key: key to insert, copied into the arena of the tree
+* Return: pointer to the created node, or NULL on failure or if the key is
+* already in the tree
+*/
+str_node_t *str_bst_insert(str_bst_t *tree, const char *key);
+
+/**
+* str_bst_remove - removes a key from a string-keyed tree
+* @tree: pointer to the tree
+* @key: key to remove
+* Return: pointer to the new root node of the tree
+*/
+str_node_t *str_bst_remove(str_bst_t *tree, const char *key);
+
+/**
+* str_bst_delete - frees the nodes and keys of a string-keyed tree
+* @tree: pointer to the tree, left empty
+*/
+void str_bst_delete(str_bst_t *tree);
+
+/**
+* str_bst_freeze - builds the sorted front-coded form of a string-keyed tree
+* @tree: pointer to the tree
+* @interval: keys from one restart to the next, 1 to store every key whole
+* @frozen: filled with the frozen form, to free with str_frozen_free
+* Return: 0 on success, -1 on failure
+*/
+int str_bst_freeze(const str_bst_t *tree, size_t interval,
+	str_frozen_t *frozen);
+
+/**
+* str_frozen_free - frees the frozen form of a tree
+* @frozen: frozen form built by str_bst_freeze
+*/
+void str_frozen_free(str_frozen_t *frozen);
+
+/**
+* str_frozen_search - searches for a key in the frozen form of a tree
+* @frozen: pointer to the frozen form
+* @key: key to search for
+* @rank: set to the number of smaller keys when the key is found, may be NULL
+* Return: 1 if the key is found, 0 otherwise
+*/
+int str_frozen_search(const str_frozen_t *frozen, const char *key,
+	size_t *rank);
+
+/**
+* str_frozen_walk - goes through the keys of a frozen form, in order
+* @frozen: pointer to the frozen form
+* @func: pointer to a function to call for each key
+* Return: number of keys gone through, 0 on failure
+*/
+size_t str_frozen_walk(const str_frozen_t *frozen, void (*func)(const char *));
+
+/**
+* avl_map_balance - updates the height of a map node and rebalances it
+* @node: pointer to the node
+* Return: pointer to the root node of the subtree, after any rotation
+*/
+avl_map_t *avl_map_balance(avl_map_t *node);
+
+/**
+* avl_map_retrace - rebalances a map from a node up to the root
+* @node: pointer to the lowest node whose subtree changed, may be NULL
+* @root: pointer to the root node of the map
+* Return: pointer to the new root node of the map
+*/
+avl_map_t *avl_map_retrace(avl_map_t *node, avl_map_t *root);
+
+/**
+* avl_map_get_or_insert - finds a key in a map, inserting it if missing
+* @map: double pointer to the root node of the map
+* @key: key to find
+* @value: value to map the key to when inserting it
+* @inserted: set to 1 if the key was inserted, 0 if found, may be NULL
+* Return: pointer to the node holding the key, or NULL on failure
+*/
+avl_map_t *avl_map_get_or_insert(avl_map_t **map, int key, void *value,
+	int *inserted);
+
+/**
+* avl_map_put - maps a key to a value, replacing any previous value
+* @map: double pointer to the root node of the map
+* @key: key to map
+* @value: value to map the key to
+* Return: pointer to the node holding the key, or NULL on failure
+*/
+avl_map_t *avl_map_put(avl_map_t **map, int key, void *value);
+
+/**
+* avl_map_upsert - inserts or updates the value of a key through a callback
+* @map: double pointer to the root node of the map
+* @key: key to insert or update
+* @func: given the current value, or NULL when inserting, the 0 or 1 the key
+* was found, and @arg, returns the value to store
+* @arg: argument passed to @func
+* Return: pointer to the node holding the key, or NULL on failure
+*/
+avl_map_t *avl_map_upsert(avl_map_t **map, int key,
+	void *(*func)(void *, int, void *), void *arg);
+
+/**
+* avl_map_get - gets the value mapped to a key
+* @map: pointer to the root node of the map
+* @key: key to look up
+* @value: set to the value when the key is found, may be NULL
+* Return: 1 if the key is found, 0 otherwise
+*/
+int avl_map_get(const avl_map_t *map, int key, void **value);
+
+/**
+* avl_map_remove - removes a key and its value from a map
+* @map: pointer to the root node of the map
+* @key: key to remove
+* @value: set to the removed value when the key is found, may be NULL
+* Return: pointer to the new root node of the map
+*/
+avl_map_t *avl_map_remove(avl_map_t *map, int key, void **value);
+
+/**
+* avl_map_delete - frees a map
+* @map: pointer to the root node of the map
+* @free_value: function called on each value, may be NULL
+*/
+void avl_map_delete(avl_map_t *map, void (*free_value)(void *));
+
+/**
+* multiset_retrace - updates heights and totals from a node up to the root,
+* rebalancing on the way
+* @node: pointer to the lowest node whose subtree changed, may be NULL
+* @root: pointer to the root node of the multiset
+* Return: pointer to the new root node of the multiset
+*/
+multiset_t *multiset_retrace(multiset_t *node, multiset_t *root);
+
+/**
+* multiset_insert - adds an occurrence of a key to a multiset
+* @set: double pointer to the root node of the multiset
+* @key: key to add
+* Return: pointer to the node holding the key, or NULL on failure
+*/
+multiset_t *multiset_insert(multiset_t **set, int key);
+
+/**
+* multiset_remove - removes an occurrence of a key from a multiset
+* @set: pointer to the root node of the multiset
+* @key: key to remove
+* Return: pointer to the new root node of the multiset
+*/
+multiset_t *multiset_remove(multiset_t *set, int key);
+
+/**
+* multiset_delete - frees a multiset
+* @set: pointer to the root node of the multiset
+*/
+void multiset_delete(multiset_t *set);
+
+/**
+* multiset_count - counts the occurrences of a key in a multiset
+* @set: pointer to the root node of the multiset
+* @key: key to count
+* Return: number of occurrences of the key
+*/
+size_t multiset_count(const multiset_t *set, int key);
+
+/**
+* multiset_rank - counts the occurrences of keys smaller than a key
+* @set: pointer to the root node of the multiset
+* @key: the key, which need not be in the multiset
+* Return: number of occurrences of smaller keys
+*/
+size_t multiset_rank(const multiset_t *set, int key);
+
+/**
+* multiset_select - finds the key of an occurrence by its rank
+* @set: pointer to the root node of the multiset
+* @rank: number of occurrences before the one to find, counting repeats
+* @key: set to the key found
+* Return: 1 if the rank is below the size of the multiset, 0 otherwise
+*/
+int multiset_select(const multiset_t *set, size_t rank, int *key);
+
+/**
+* multiset_walk - goes through the keys of a multiset and their counts, in
+* order
+* @set: pointer to the root node of the multiset
+* @func: pointer to a function to call with each key and its count
+* Return: number of distinct keys
+*/
+size_t multiset_walk(const multiset_t *set, void (*func)(int, size_t));
+
+/**
+* topk_create - creates a selection of the greatest values of a stream
+* @k: number of values to keep
+* Return: pointer to the selection, or NULL on failure
+*/
+topk_t *topk_create(size_t k);
+
+/**
+* topk_push - offers a value to a top-K selection
+* @topk: pointer to the selection
+* @value: value offered
+* Return: 1 if the value is kept, 0 otherwise
+*/
+int topk_push(topk_t *topk, int value);
+
+/**
+* topk_push_batch - offers an array of values to a top-K selection
+* @topk: pointer to the selection
+* @values: values offered, in stream order
+* @n: number of values
+* Return: number of values kept when offered
+*/
+size_t topk_push_batch(topk_t *topk, const int *values, size_t n);
+
+/**
+* topk_to_sorted_array - converts a top-K selection to a sorted array
+* @topk: pointer to the selection, freed
+* @size: address to store the size of the array
+* Return: pointer to the array sorted in descending order, or NULL
+*/
+int *topk_to_sorted_array(topk_t *topk, size_t *size);
+
+/**
+* topk_free - frees a top-K selection
+* @topk: pointer to the selection
+*/
+void topk_free(topk_t *topk);
+
 #endif /* _BINARY_TREES_H_ */
@@ -0,0 +1,401 @@
+#ifndef _TREE_TEMPLATE_H_
+#define _TREE_TEMPLATE_H_
+
+#include <stdlib.h>
+
+/*
+* Header-only trees specialized for a key type, a value type and an inline
+* comparator. TREE_DEFINE(name, key type, value type, cmp) generates the
+* name_t node type and the functions below, all static inline. cmp(a, b)
+* may be a function-like macro or an inline function taking two keys and
+* giving a negative, zero or positive int, so that each comparison is
+* compiled inline for the key type.
+*/
+
+/**
+* TREE_CMP - compares two numeric keys
+* @a: first key
+* @b: second key
+* Return: -1, 0 or 1 as @a is less than, equal to or greater than @b
+*/
+#define TREE_CMP(a, b) (((a) > (b)) - ((a) < (b)))
+
+/**
+* TREE_DEFINE_NODE - generates the node type and its helpers
+* @name: prefix of the generated type and functions
+* @K: key type
+* @V: value type
+*
+* Description: Generates name_t, and
+* name_node(parent, key, value), which creates a node, or returns NULL
+* name_delete(tree), which frees a tree without recursing
+* name_height(tree), which gives the cached height of a tree, 0 if NULL
+* name_rotate_left(tree) and name_rotate_right(tree), which rotate as
+* binary_tree_rotate_left and binary_tree_rotate_right do, keeping heights
+*/
+#define TREE_DEFINE_NODE(name, K, V) \
+typedef struct name##_s \
+{ \
+	K key; \
+	V value; \
+	int height; \
+	struct name##_s *parent; \
+	struct name##_s *left; \
+	struct name##_s *right; \
+} name##_t; \
+static __inline__ name##_t *name##_node(name##_t *parent, K key, V value) \
+{ \
+	name##_t *node = malloc(sizeof(name##_t)); \
+\
+	if (!node) \
+		return (NULL); \
+	node->key = key; \
+	node->value = value; \
+	node->height = 1; \
+	node->parent = parent; \
+	node->left = NULL; \
+	node->right = NULL; \
+	return (node); \
+} \
+static __inline__ void name##_delete(name##_t *tree) \
+{ \
+	name##_t *next; \
+\
+	while (tree) \
+	{ \
+		if (tree->left) \
+		{ \
+			next = tree->left; \
+			tree->left = next->right; \
+			next->right = tree; \
+		} \
+		else \
+		{ \
+			next = tree->right; \
+			free(tree); \
+		} \
+		tree = next; \
+	} \
+} \
+static __inline__ int name##_height(const name##_t *tree) \
+{ \
+	return (tree ? tree->height : 0); \
+} \
+static __inline__ void name##_update(name##_t *tree) \
+{ \
+	int l = name##_height(tree->left), r = name##_height(tree->right); \
+\
+	tree->height = 1 + (l > r ? l : r); \
+} \
+static __inline__ name##_t *name##_rotate_left(name##_t *tree) \
+{ \
+	name##_t *new_root = tree->right; \
+\
+	tree->right = new_root->left; \
+	if (new_root->left) \
+		new_root->left->parent = tree; \
+	new_root->parent = tree->parent; \
+	if (tree->parent && tree->parent->left == tree) \
+		tree->parent->left = new_root; \
+	else if (tree->parent) \
+		tree->parent->right = new_root; \
+	tree->parent = new_root; \
+	new_root->left = tree; \
+	name##_update(tree); \
+	name##_update(new_root); \
+	return (new_root); \
+} \
+static __inline__ name##_t *name##_rotate_right(name##_t *tree) \
+{ \
+	name##_t *new_root = tree->left; \
+\
+	tree->left = new_root->right; \
+	if (new_root->right) \
+		new_root->right->parent = tree; \
+	new_root->parent = tree->parent; \
+	if (tree->parent && tree->parent->left == tree) \
+		tree->parent->left = new_root; \
+	else if (tree->parent) \
+		tree->parent->right = new_root; \
+	tree->parent = new_root; \
+	new_root->right = tree; \
+	name##_update(tree); \
+	name##_update(new_root); \
+	return (new_root); \
+}
+
+/**
+* TREE_DEFINE_BST - generates the binary search tree functions
+* @name: prefix given to TREE_DEFINE_NODE
+* @K: key type
+* @V: value type
+* @cmp: comparator of two keys
+*
+* Description: Generates
+* name_bst_search(tree, key), which returns the node holding key, or NULL
+* name_bst_insert(&tree, key, value), which returns the new node, or NULL
+* on failure or if key is already in the tree
+* name_bst_remove(root, key), which returns the new root
+* name_unlink(&root, node), which frees a node, moving its successor in
+* its place if it has two children, and returns the parent of the node
+* actually freed
+*/
+#define TREE_DEFINE_BST(name, K, V, cmp) \
+static __inline__ name##_t *name##_bst_search(const name##_t *tree, K key) \
+{ \
+	int c; \
+\
+	while (tree) \
+	{ \
+		c = cmp(key, tree->key); \
+		if (c == 0) \
+			return ((name##_t *)tree); \
+		tree = c < 0 ? tree->left : tree->right; \
+	} \
+	return (NULL); \
+} \
+static __inline__ name##_t *name##_bst_insert(name##_t **tree, K key, \
+	V value) \
+{ \
+	name##_t *parent = NULL, **link; \
+	int c; \
+\
+	if (!tree) \
+		return (NULL); \
+	for (link = tree; *link; \
+		link = c < 0 ? &parent->left : &parent->right) \
+	{ \
+		parent = *link; \
+		c = cmp(key, parent->key); \
+		if (c == 0) \
+			return (NULL); \
+	} \
+	*link = name##_node(parent, key, value); \
+	return (*link); \
+} \
+static __inline__ name##_t *name##_unlink(name##_t **root, name##_t *node) \
+{ \
+	name##_t *next, *child, *parent; \
+\
+	if (node->left && node->right) \
+	{ \
+		for (next = node->right; next->left; next = next->left) \
+			; \
+		node->key = next->key; \
+		node->value = next->value; \
+		node = next; \
+	} \
+	child = node->left ? node->left : node->right; \
+	parent = node->parent; \
+	if (child) \
+		child->parent = parent; \
+	if (!parent) \
+		*root = child; \
+	else if (parent->left == node) \
+		parent->left = child; \
+	else \
+		parent->right = child; \
+	free(node); \
+	return (parent); \
+} \
+static __inline__ name##_t *name##_bst_remove(name##_t *root, K key) \
+{ \
+	name##_t *node = name##_bst_search(root, key); \
+\
+	if (node) \
+		name##_unlink(&root, node); \
+	return (root); \
+}
+
+/**
+* TREE_DEFINE_AVL - generates the AVL tree functions
+* @name: prefix given to TREE_DEFINE_NODE and TREE_DEFINE_BST
+* @K: key type
+* @V: value type
+*
+* Description: Heights are cached in the nodes, so insertion and removal
+* retrace a single path, stopping as soon as heights stop changing.
+* Generates
+* name_avl_insert(&tree, key, value), which returns the new node, or NULL
+* on failure or if key is already in the tree
+* name_avl_remove(root, key), which returns the new root
+*/
+#define TREE_DEFINE_AVL(name, K, V) \
+static __inline__ name##_t *name##_balance(name##_t *tree) \
+{ \
+	int b = name##_height(tree->left) - name##_height(tree->right); \
+\
+	name##_update(tree); \
+	if (b > 1) \
+	{ \
+		if (name##_height(tree->left->left) < \
+			name##_height(tree->left->right)) \
+			name##_rotate_left(tree->left); \
+		return (name##_rotate_right(tree)); \
+	} \
+	if (b < -1) \
+	{ \
+		if (name##_height(tree->right->right) < \
+			name##_height(tree->right->left)) \
+			name##_rotate_right(tree->right); \
+		return (name##_rotate_left(tree)); \
+	} \
+	return (tree); \
+} \
+static __inline__ name##_t *name##_retrace(name##_t *node, name##_t *root) \
+{ \
+	int h; \
+\
+	for (; node; node = node->parent) \
+	{ \
+		h = node->height; \
+		node = name##_balance(node); \
+		if (!node->parent) \
+			return (node); \
+		if (node->height == h) \
+			return (root); \
+	} \
+	return (root); \
+} \
+static __inline__ name##_t *name##_avl_insert(name##_t **tree, K key, \
+	V value) \
+{ \
+	name##_t *node = name##_bst_insert(tree, key, value); \
+\
+	if (node) \
+		*tree = name##_retrace(node->parent, *tree); \
+	return (node); \
+} \
+static __inline__ name##_t *name##_avl_remove(name##_t *root, K key) \
+{ \
+	name##_t *node = name##_bst_search(root, key); \
+\
+	if (!node) \
+		return (root); \
+	node = name##_unlink(&root, node); \
+	return (name##_retrace(node, root)); \
+}
+
+/**
+* TREE_DEFINE_HEAP - generates the max binary heap functions
+* @name: prefix given to TREE_DEFINE_NODE
+* @K: key type
+* @V: value type
+* @cmp: comparator of two keys
+*
+* Description: The caller keeps the number of nodes, which locates the
+* last node along the bits of its level-order position, so insertion and
+* extraction take O(log n). Generates
+* name_heap_insert(&root, &size, key, value), which returns the node
+* holding the inserted key, or NULL on failure
+* name_heap_extract(&root, &size, &key, &value), which moves the greatest
+* key and its value out of the heap, returning 1, or 0 if it is empty;
+* either pointer may be NULL
+*/
+#define TREE_DEFINE_HEAP(name, K, V, cmp) \
+static __inline__ name##_t *name##_heap_at(name##_t *root, size_t pos) \
+{ \
+	size_t bit; \
+\
+	for (bit = 1; bit <= pos >> 1; bit <<= 1) \
+		; \
+	for (bit >>= 1; bit; bit >>= 1) \
+		root = pos & bit ? root->right : root->left; \
+	return (root); \
+} \
+static __inline__ void name##_swap(name##_t *a, name##_t *b) \
+{ \
+	K key = a->key; \
+	V value = a->value; \
+\
+	a->key = b->key; \
+	a->value = b->value; \
+	b->key = key; \
+	b->value = value; \
+} \
+static __inline__ name##_t *name##_heap_insert(name##_t **root, \
+	size_t *size, K key, V value) \
+{ \
+	name##_t *parent, *node; \
+\
+	if (!root || !size) \
+		return (NULL); \
+	parent = *root ? name##_heap_at(*root, (*size + 1) >> 1) : NULL; \
+	node = name##_node(parent, key, value); \
+	if (!node) \
+		return (NULL); \
+	if (!parent) \
+		*root = node; \
+	else if ((*size + 1) & 1) \
+		parent->right = node; \
+	else \
+		parent->left = node; \
+	*size = parent ? *size + 1 : 1; \
+	while (node->parent && cmp(node->key, node->parent->key) > 0) \
+	{ \
+		name##_swap(node, node->parent); \
+		node = node->parent; \
+	} \
+	return (node); \
+} \
+static __inline__ void name##_heap_down(name##_t *node) \
+{ \
+	name##_t *big; \
+\
+	while (1) \
+	{ \
+		big = node; \
+		if (node->left && cmp(node->left->key, big->key) > 0) \
+			big = node->left; \
+		if (node->right && cmp(node->right->key, big->key) > 0) \
+			big = node->right; \
+		if (big == node) \
+			return; \
+		name##_swap(node, big); \
+		node = big; \
+	} \
+} \
+static __inline__ int name##_heap_extract(name##_t **root, size_t *size, \
+	K *key, V *value) \
+{ \
+	name##_t *last; \
+\
+	if (!root || !*root || !size || !*size) \
+		return (0); \
+	if (key) \
+		*key = (*root)->key; \
+	if (value) \
+		*value = (*root)->value; \
+	last = name##_heap_at(*root, (*size)--); \
+	if (last == *root) \
+	{ \
+		free(last); \
+		*root = NULL; \
+		return (1); \
+	} \
+	(*root)->key = last->key; \
+	(*root)->value = last->value; \
+	if (last->parent->right == last) \
+		last->parent->right = NULL; \
+	else \
+		last->parent->left = NULL; \
+	free(last); \
+	name##_heap_down(*root); \
+	return (1); \
+}
+
+/**
+* TREE_DEFINE - generates a binary search tree, an AVL tree and a max
+* binary heap specialized for a key type, a value type and a comparator
+* @name: prefix of the generated type and functions
+* @K: key type
+* @V: value type
+* @cmp: comparator of two keys, such as TREE_CMP for numeric keys
+*/
+#define TREE_DEFINE(name, K, V, cmp) \
+	TREE_DEFINE_NODE(name, K, V) \
+	TREE_DEFINE_BST(name, K, V, cmp) \
+	TREE_DEFINE_AVL(name, K, V) \
+	TREE_DEFINE_HEAP(name, K, V, cmp)
+
+#endif /* _TREE_TEMPLATE_H_ */